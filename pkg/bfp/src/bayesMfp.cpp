@@ -1,9 +1,17 @@
 #include "rcppExport.h"
-#include "RnewMat.h"
+#include "design.h"
+#include "linalgInterface.h"
 #include <R_ext/Visibility.h>
 #include "combinatorics.h"
 #include "dataStructure.h"
 #include "hyperg.h"
+#include "memoryUsage.h"
+#include "rngStreams.h"
+#include "modelProposal.h"
+#include "checkpoint.h"
+#include "modelStore.h"
+#include "incrementalR2.h"
+#include "sufficientStats.h"
 #include <map>
 #include <vector>
 #include <algorithm>
@@ -14,6 +22,7 @@
 #include <climits>
 #include "conversions.h"
 #include <cmath>
+#include <chrono>
 #include "mytypes.h"
 
 // using pretty much:
@@ -47,7 +56,11 @@ SEXP exhaustiveGaussian(// declaration
                         SEXP R_hyperparam, // hyperparameter a for hyper-g prior
                         SEXP R_priorType, // type of model prior?
                         SEXP R_nModels, // number of best models to be returned
-                        SEXP R_verbose); // should progress been displayed?
+                        SEXP R_verbose, // should progress been displayed?
+                        SEXP R_modelStoreFile, // where to store the computed models ("" for none)?
+                        SEXP R_modelStoreKey, // fingerprint of the model search for the store
+                        SEXP R_grayCode, // enumerate the models in minimal change order?
+                        SEXP R_sufficientStats); // sufficient statistics of the out-of-core data (or NULL)
 
 SEXP samplingGaussian(// declaration
                       SEXP R_x, // (not centered!) design matrix (with colnames)
@@ -66,7 +79,18 @@ SEXP samplingGaussian(// declaration
                       SEXP R_nModels, // number of best models to be returned
                       SEXP R_verbose, // should progress been displayed?
                       SEXP R_chainlength, // how many times should a jump been made?
-                      SEXP R_nCache); // size of models cache (an STL map)
+                      SEXP R_nCache, // size of models cache (an STL map)
+                      SEXP R_legacyRng, // use R's random number generator directly?
+                      SEXP R_adaptationLength, // how many jumps for learning the proposal weights?
+                      SEXP R_temperatures, // temperature ladder for parallel tempering
+                      SEXP R_swapInterval, // how many jumps between the replica swaps?
+                      SEXP R_checkpointFile, // where to save checkpoints ("" for none)?
+                      SEXP R_checkpointInterval, // how many jumps between the checkpoints?
+                      SEXP R_resume, // continue the chain from the checkpoint?
+                      SEXP R_modelStoreFile, // where to store the computed models ("" for none)?
+                      SEXP R_modelStoreKey, // fingerprint of the model search for the store
+                      SEXP R_sufficientStats, // sufficient statistics of the out-of-core data (or NULL)
+                      SEXP R_anytime); // maximum seconds and model evaluations, epsilon and window for convergence
 
 SEXP logMargLik( //declaration
                 SEXP R_R2, // coefficient of determination
@@ -87,6 +111,86 @@ SEXP postExpectedShrinkage( //declaration
                 SEXP R_dim, // number of columns of the design matrix
                 SEXP R_alpha); // hyperparamater for hyper-g prior
 
+SEXP bmaSamples( // declaration, see bmaSamples.cpp
+                SEXP R_x, // (not centered!) design matrix
+                SEXP R_xcentered, // centered design matrix
+                SEXP R_y, // response vector
+                SEXP R_fpmaxs, // vector of maximum fp degrees
+                SEXP R_fppos, // corresponding vector of fp column indices
+                SEXP R_fpcards, // corresponding vector of power set cardinalities
+                SEXP R_nFps, // number of fp terms
+                SEXP R_fpnames, // names of fp terms
+                SEXP R_ucIndices, // vector giving _unc_ertainty custer indices (column -> which group)
+                SEXP R_ucTermList, // list for group -> which columns mapping
+                SEXP R_nUcGroups, // number of uncertainty groups
+                SEXP R_hyperparam, // hyperparameter a for hyper-g prior
+                SEXP R_models, // list of the models (elements of the BayesMfp object)
+                SEXP R_freqs, // number of samples from each model
+                SEXP R_grids, // list of scaled grids for the FP curves (or NULL if not needed)
+                SEXP R_newX, // covariates matrix for new data (or NULL)
+                SEXP R_includeZeroSamples, // include zero samples for not included covariates?
+                SEXP R_legacyRng); // use R's random number generator directly?
+
+// credible bands, see credibleBands.cpp
+
+SEXP pointwiseHpds( // declaration
+                SEXP R_samples, // samples matrix, each row is a sample
+                SEXP R_level); // credible level
+
+SEXP simultaneousBand( // declaration
+                SEXP R_samples, // samples matrix, each row is a sample
+                SEXP R_mode, // mode vector for the HPD band, or NULL for the Besag band
+                SEXP R_level); // credible level
+
+SEXP bandStreamNew( // declaration
+                SEXP R_nPars, // number of parameters
+                SEXP R_mode); // mode vector for the HPD band, or NULL for the Besag band
+
+SEXP bandStreamAdd( // declaration
+                SEXP R_stream, // the band stream
+                SEXP R_chunk); // chunk of samples, each row is a sample
+
+SEXP bandStreamBand( // declaration
+                SEXP R_stream, // the band stream
+                SEXP R_level); // credible level
+
+// out-of-core data, see sufficientStats.cpp
+
+SEXP columnFileInfo( // declaration
+                SEXP R_file); // the column file name
+
+SEXP columnFileRead( // declaration
+                SEXP R_file, // the column file name
+                SEXP R_columns, // the (1-based) columns to read
+                SEXP R_first, // the first (1-based) row to read
+                SEXP R_n); // the number of rows to read
+
+SEXP columnFileStats( // declaration
+                SEXP R_file, // the column file name
+                SEXP R_fileCols, // for each design matrix column its file column, 0 for the intercept
+                SEXP R_responseCol, // the file column of the response
+                SEXP R_fppos, // the design matrix columns of the FPs
+                SEXP R_fpmaxs, // vector of maximum fp degrees
+                SEXP R_fpcards, // corresponding vector of power set cardinalities
+                SEXP R_shifts, // the prescaling shifts of the FPs
+                SEXP R_scales, // and their scales
+                SEXP R_chunkSize); // how many rows are processed at once?
+
+SEXP kernelBenchmark( // declaration
+                SEXP R_x, // (not centered!) design matrix (with colnames)
+                SEXP R_xcentered, // centered design matrix
+                SEXP R_y, // response vector
+                SEXP R_fpmaxs, // vector of maximum fp degrees
+                SEXP R_fppos, // corresponding vector of fp column indices
+                SEXP R_fpcards, // corresponding vector of power set cardinalities
+                SEXP R_nFps, // number of fp terms
+                SEXP R_fpnames, // names of fp terms
+                SEXP R_ucIndices, // vector giving _unc_ertainty custer indices (column -> which group)
+                SEXP R_ucTermList, // list for group -> which columns mapping
+                SEXP R_nUcGroups, // number of uncertainty groups
+                SEXP R_hyperparam, // hyperparameter a for hyper-g prior
+                SEXP R_nModels); // number of random models to time
+
 
 // export to C interface ##########################################################################
 
@@ -94,11 +198,21 @@ extern "C"
 {
   
 static const R_CallMethodDef callMethods[] = {
-  {"exhaustiveGaussian", (DL_FUNC) &exhaustiveGaussian, 16},
-  {"samplingGaussian", (DL_FUNC) &samplingGaussian, 17},
+  {"exhaustiveGaussian", (DL_FUNC) &exhaustiveGaussian, 20},
+  {"samplingGaussian", (DL_FUNC) &samplingGaussian, 28},
   {"logMargLik", (DL_FUNC) &logMargLik, 5},
   {"postExpectedg", (DL_FUNC) &postExpectedg, 4},
   {"postExpectedShrinkage", (DL_FUNC) &postExpectedShrinkage, 4},
+  {"bmaSamples", (DL_FUNC) &bmaSamples, 18},
+  {"pointwiseHpds", (DL_FUNC) &pointwiseHpds, 2},
+  {"simultaneousBand", (DL_FUNC) &simultaneousBand, 3},
+  {"bandStreamNew", (DL_FUNC) &bandStreamNew, 2},
+  {"bandStreamAdd", (DL_FUNC) &bandStreamAdd, 2},
+  {"bandStreamBand", (DL_FUNC) &bandStreamBand, 2},
+  {"columnFileInfo", (DL_FUNC) &columnFileInfo, 1},
+  {"columnFileRead", (DL_FUNC) &columnFileRead, 4},
+  {"columnFileStats", (DL_FUNC) &columnFileStats, 9},
+  {"kernelBenchmark", (DL_FUNC) &kernelBenchmark, 13},
   {NULL, NULL, 0}
 };
 
@@ -122,65 +236,73 @@ void permPars(PosInt pos, // current position in parameter vector, starting from
               modelPar mod,
               set<model> &space,
               const hyperPriorPars &hyp,
+              HypergEngine &hyperg,
               const dataValues &data,
               const vector<IntSet>& ucTermList,
               const set<int> &fixedCols,
+              ModelStore &store,
               book&);
 
-set<int> getFreeUcs( // compute set of free uc group indices
-                   const modelPar& mod,
-                   const vector<PosInt>& ucSizes,
-                   const PosInt& currDim,
-                   const PosInt& maxDim);
-
-set<PosInt> getFreeCovs( // compute set of free cov indices
-                             const modelPar& mod,
-                             const fpInfo& currFp,
-                             const set<int>& freeUcs,
-                             const PosInt& currDim,
-                             const PosInt& maxDim);
-set<PosInt> getPresentCovs( // determine set of present cov indices
-        const modelPar& mod);
-
-template <class T> T discreteUniform( // return random element of myset; should be enclosed in getRNGstate() etc.
-const set<T>& myset);
+void grayPermPars(PosInt pos, // current position in the vector of FPs and UC groups, starting from 0
+                  const vector<vector<Powers> >& fpValues,
+                  vector<bool>& forward,
+                  const fpInfo &currFp,
+                  const int &nUcGroups,
+                  modelPar &mod,
+                  set<model> &space,
+                  const hyperPriorPars &hyp,
+                  HypergEngine &hyperg,
+                  const dataValues &data,
+                  const vector<IntSet>& ucTermList,
+                  const set<int> &fixedCols,
+                  ModelStore &store,
+                  IncrementalR2 &incremental,
+                  book&);
 
 template <class T> typename T::iterator dU( // return iterator of random element of myset; should be enclosed in getRNGstate() etc.
-const T& myset);
+const T& myset,
+RngStream& rng);
 
 int discreteUniform( // get random int x with lower <= x < upper; should be enclosed in getRNGstate() etc.
                     const int& lower,
-                    const int& upper);
+                    const int& upper,
+                    RngStream& rng);
 
 void computeModel(const modelPar &mod,
                   const hyperPriorPars &hyp,
+                  HypergEngine &hyperg,
                   const dataValues &data,
                   const fpInfo &currFp,
                   const vector<IntSet>& ucTermList,
                   const int &nUcGroups,
                   const set<int> &fixedCols,
                   set<model> &space,
-                  book&);
-
-ReturnMatrix getDesignMatrix( // construct design matrix for the model
-                             const modelPar &mod,
-                             const dataValues &data,
-                             const fpInfo &currFp,
-                             const vector<IntSet>& ucTermList,
-                             const int &nUcGroups,
-                             const set<int> &fixedCols);
+                  ModelStore &store,
+                  book&,
+                  IncrementalR2* incremental = 0); // for the R2 along the minimal change order
 
 double getR2( // compute coefficient of determination for the model
-             const Matrix &design,
+             const AMatrix &design,
              const dataValues &data,
              const set<int> &fixedCols,
              const hyperPriorPars &hyp);
 
-double getVarLogMargLik( // compute varying part of log marginal likelihood for specific model
+double getModelR2( // compute coefficient of determination and design matrix dimension for the model,
+                   // from the sufficient statistics if the data are out-of-core
+                  const modelPar &mod,
+                  const dataValues &data,
+                  const fpInfo &currFp,
+                  const vector<IntSet>& ucTermList,
+                  const int &nUcGroups,
+                  const set<int> &fixedCols,
+                  const hyperPriorPars &hyp,
+                  int &dim);
+
+HypergResult getVarLogMargLik( // compute varying part of log marginal likelihood for specific model,
+                               // together with posterior expected g and shrinkage factor
                         const double &R2,
-                        const int &n,
                         const int &dim,
-                        const hyperPriorPars &hyp);
+                        HypergEngine &hyperg);
 
 double getVarLogPrior( // compute logarithm of model prior
                       const modelPar &mod,
@@ -188,11 +310,6 @@ double getVarLogPrior( // compute logarithm of model prior
                       const PosInt nUcGroups,
                       const hyperPriorPars &hyp);
 
-ReturnMatrix getFpMatrix( // build Fp basis matrix from transformed cols and power indices
-                         const vector<ColumnVector> &tcols,
-                         const Powers &powerinds,
-                         const dataValues &data);
-
 void pushInclusionProbs( // push back index into covGroupWisePosteriors-Array
                         const modelPar &mod,
                         const fpInfo &currFp,
@@ -221,16 +338,22 @@ exhaustiveGaussian(// definition
                    SEXP R_hyperparam, // hyperparameter a for hyper-g prior
                    SEXP R_priorType, // type of model prior?
                    SEXP R_nModels, // number of best models to be returned
-                   SEXP R_verbose) // should progress been displayed?
+                   SEXP R_verbose, // should progress been displayed?
+                   SEXP R_modelStoreFile, // where to store the computed models ("" for none)?
+                   SEXP R_modelStoreKey, // fingerprint of the model search for the store
+                   SEXP R_grayCode, // enumerate the models in minimal change order?
+                   SEXP R_sufficientStats) // sufficient statistics of the out-of-core data (or NULL)
 {
+    BEGIN_RCPP
 
     PosInt nProtect = 0;
 
     // unpack ###
 	// data
-	const Matrix x = getMatrix(R_x);
-	const Matrix xcentered = getMatrix(R_xcentered);
-	const ColumnVector y = vec2col(R_y);
+	// (views of the R memory, nothing is copied)
+	const AMatrix x = shareMatrix(R_x);
+	const AMatrix xcentered = shareMatrix(R_xcentered);
+	const AVector y = shareVector(R_y);
 
 	// prior specifications
 	const double hyperparam = Rf_asReal(R_hyperparam);
@@ -241,8 +364,11 @@ exhaustiveGaussian(// definition
 
 	const double totalNumber = REAL(R_totalNumber)[0]; // cardinality of model space
 
+	// sufficient statistics, if the data are out-of-core and x, xcentered and y are empty
+	const SufficientStats stats(R_sufficientStats);
+
 	// constant information
-	const dataValues data(x, xcentered, y, totalNumber);
+	const dataValues data(x, xcentered, y, totalNumber, stats.active() ? &stats : 0);
 
 	// fp info
 	fpInfo currentFpInfo(R_nFps,
@@ -304,13 +430,51 @@ exhaustiveGaussian(// definition
 	// how many models to return?
 	bookkeep.nModels = INTEGER(R_nModels)[0];
 
+	// hyper-g evaluation engine for this sample size and hyperparameter
+	HypergEngine hyperg(data.nObs, hyp.a);
+
+	// the persistent store of the models computed in earlier runs
+	ModelStore store(getStringVector(R_modelStoreFile).at(0), R_modelStoreKey);
+
 	// start computation
-	permPars(0, currentFpInfo, nUcGroups, startModel, orderedModels, hyp, data, ucTermList, fixedCols, bookkeep);
+	if (LOGICAL(R_grayCode)[0]){
+		// all power multisets of each FP, starting with the empty one
+		vector<vector<Powers> > fpValues(currentFpInfo.nFps);
+		for (PosInt i = 0; i != currentFpInfo.nFps; i++){
+			fpValues[i].push_back(Powers());
+			for (int deg = 1; deg <= currentFpInfo.fpmaxs[i]; deg++){
+				IntVector part(currentFpInfo.fpcards[i]);
+				bool more = false;
+				int h(0), t(0);
+				do {
+					comp_next(deg, currentFpInfo.fpcards[i], part, &more, h, t);
+					fpValues[i].push_back(freqvec2multiset(part));
+				} while (more);
+			}
+		}
+		vector<bool> forward(currentFpInfo.nFps + nUcGroups, true);
+		IncrementalR2 incremental(data, currentFpInfo, ucTermList);
+
+		grayPermPars(0, fpValues, forward, currentFpInfo, nUcGroups, startModel, orderedModels, hyp, hyperg, data,
+		             ucTermList, fixedCols, store, incremental, bookkeep);
+	} else {
+		permPars(0, currentFpInfo, nUcGroups, startModel, orderedModels, hyp, hyperg, data, ucTermList, fixedCols, store, bookkeep);
+	}
+
+	// save the newly computed models for later runs
+	store.flush();
 
 	if (bookkeep.verbose){
 		Rprintf("\nActual number of possible models:  %lu ", bookkeep.modelCounter);
 		Rprintf("\nNumber of non-identifiable models: %lu", bookkeep.nanCounter);
 		Rprintf("\nNumber of saved possible models:   %zu\n", orderedModels.size());
+
+		MemoryReport memory;
+		memory.add(data.design);
+		memory.add(data.centeredDesign);
+		memory.add(data.response);
+		memory.add(stats.gram);
+		memory.print();
 	}
 
 	// normalize posterior probabilities and correct log marg lik and log prior of the models to return
@@ -348,10 +512,13 @@ exhaustiveGaussian(// definition
 	Rf_setAttrib(ret, Rf_install("inclusionProbs"), inc);
 	Rf_setAttrib(ret, Rf_install("linearInclusionProbs"), linearInc);
 	Rf_setAttrib(ret, Rf_install("logNormConst"), Rf_ScalarReal(logNormConst));
+	if (store.active())
+		Rf_setAttrib(ret, Rf_install("modelStore"), store.convert2list());
 
 	// return ###
 	Rf_unprotect(nProtect);
 	return ret;
+    END_RCPP
 }
 
 // ***************************************************************************************************//
@@ -363,14 +530,16 @@ void permPars(PosInt pos, // current position in parameter vector, starting from
               modelPar mod,	// is copied every time! everything else is call by reference.
               set<model> &space,
               const hyperPriorPars &hyp,
+              HypergEngine &hyperg,
               const dataValues &data,
               const vector<IntSet>& ucTermList,
               const set<int> &fixedCols,
+              ModelStore &store,
               book &bookkeep)
 {
 	if (pos != currFp.nFps){ // some fps are still left
 		const int card = currFp.fpcards[pos]; // cardinality of this power set
-		permPars(pos + 1, currFp, nUcGroups, mod, space, hyp, data, ucTermList, fixedCols, bookkeep); // degree 0
+		permPars(pos + 1, currFp, nUcGroups, mod, space, hyp, hyperg, data, ucTermList, fixedCols, store, bookkeep); // degree 0
 		for (int deg = 1; deg <= currFp.fpmaxs[pos]; deg++){ // different degrees for fp at pos
 			mod.fpSize++; // increment sums of fp degrees
 			IntVector part(card); // partition of deg into card parts
@@ -380,11 +549,11 @@ void permPars(PosInt pos, // current position in parameter vector, starting from
 				comp_next(deg, card, part, &more1, h, t);	// next partition of deg into card parts
 				mod.fpPars[pos] = freqvec2multiset(part); // convert into multiset
 				// and go on
-				permPars(pos + 1, currFp, nUcGroups, mod, space, hyp, data, ucTermList, fixedCols, bookkeep);
+				permPars(pos + 1, currFp, nUcGroups, mod, space, hyp, hyperg, data, ucTermList, fixedCols, store, bookkeep);
 			} while (more1);
 		}
 	} else { // no fps left
-		computeModel(mod, hyp, data, currFp, ucTermList, nUcGroups, fixedCols, space, bookkeep);
+		computeModel(mod, hyp, hyperg, data, currFp, ucTermList, nUcGroups, fixedCols, space, store, bookkeep);
 		for (int deg = 1; deg <= nUcGroups; deg++){ // different number of uc groups
 			mod.ucSize++; // increment number of uc groups present
 			IntVector subset(deg); // partition of deg into card parts
@@ -393,51 +562,113 @@ void permPars(PosInt pos, // current position in parameter vector, starting from
 			do {
 				ksub_next(nUcGroups, deg, subset, &more2, m, m2);	// next subset (positive integers)
 				mod.ucPars = set<int>(subset.begin(), subset.end()); // convert into set
-				computeModel(mod, hyp, data, currFp, ucTermList, nUcGroups, fixedCols, space, bookkeep);
+				computeModel(mod, hyp, hyperg, data, currFp, ucTermList, nUcGroups, fixedCols, space, store, bookkeep);
 			} while (more2);
 		}
 	}
 }
 
+// ***************************************************************************************************//
 
+// minimal change enumeration: a reflected mixed-radix Gray code over the FPs (with all power
+// multisets as values) and the UC groups (absent or present). Each coordinate sweeps its values
+// alternately forwards and backwards, so consecutive models differ in one FP or UC group only,
+// and the blocks of the deeper coordinates change most often. With the model stack of
+// IncrementalR2 in the same order, mostly the top block of the factorization must be updated.
+void grayPermPars(PosInt pos, // current position in the vector of FPs and UC groups, starting from 0
+                  const vector<vector<Powers> >& fpValues, // the values of each FP
+                  vector<bool>& forward, // the current sweep directions
+                  const fpInfo &currFp,
+                  const int &nUcGroups,
+                  modelPar &mod, // the current model, changed in place
+                  set<model> &space,
+                  const hyperPriorPars &hyp,
+                  HypergEngine &hyperg,
+                  const dataValues &data,
+                  const vector<IntSet>& ucTermList,
+                  const set<int> &fixedCols,
+                  ModelStore &store,
+                  IncrementalR2 &incremental,
+                  book &bookkeep)
+{
+	if (pos == currFp.nFps + nUcGroups){ // all coordinates are set
+		computeModel(mod, hyp, hyperg, data, currFp, ucTermList, nUcGroups, fixedCols, space, store, bookkeep, &incremental);
+		return;
+	}
+
+	if (pos < currFp.nFps){ // an FP
+		const vector<Powers>& values = fpValues[pos];
+		for (vector<Powers>::size_type k = 0; k != values.size(); k++){
+			const Powers& now = values[forward[pos] ? k : values.size() - 1 - k];
+			mod.fpSize -= mod.fpPars[pos].size();
+			mod.fpSize += now.size();
+			mod.fpPars[pos] = now;
+
+			grayPermPars(pos + 1, fpValues, forward, currFp, nUcGroups, mod, space, hyp, hyperg, data,
+			             ucTermList, fixedCols, store, incremental, bookkeep);
+		}
+	} else { // a UC group
+		const int group = pos - currFp.nFps + 1;
+		for (int k = 0; k != 2; k++){
+			const bool present = forward[pos] ? (k == 1) : (k == 0);
+			if (present)
+				mod.ucPars.insert(group);
+			else
+				mod.ucPars.erase(group);
+			mod.ucSize = mod.ucPars.size();
+
+			grayPermPars(pos + 1, fpValues, forward, currFp, nUcGroups, mod, space, hyp, hyperg, data,
+			             ucTermList, fixedCols, store, incremental, bookkeep);
+		}
+	}
+
+	// the next sweep goes the other way round
+	forward[pos] = ! forward[pos];
+}
 
 // ***************************************************************************************************//
 
 void computeModel(// compute (varying part of) marginal likelihood and prior of mod and insert into map
 					const modelPar &mod,
 					const hyperPriorPars &hyp,
+					HypergEngine &hyperg,
 					const dataValues &data,
 					const fpInfo &currFp,
 					const vector<IntSet>& ucTermList,
 					const int &nUcGroups,
 					const set<int> &fixedCols,
 					set<model> &space,
-					book &bookkeep
+					ModelStore &store,
+					book &bookkeep,
+					IncrementalR2* incremental
 				 )
 {
 	static set<model>::size_type compCounter = 0;
 
-	// design matrix
-	Matrix thisDesign = getDesignMatrix(mod, data, currFp, ucTermList, nUcGroups, fixedCols);
+	// R2 and dimension, from the store if the model was computed in an earlier run
+	double thisR2;
+	int thisDim;
+	if (! store.find(mod, thisR2, thisDim)){
+		if (incremental){
+			// R2 by updating the factorization of the previous model
+			thisR2 = incremental->R2(mod, hyp, thisDim);
+		} else {
+			thisR2 = getModelR2(mod, data, currFp, ucTermList, nUcGroups, fixedCols, hyp, thisDim);
+		}
 
-	// R2
-	double thisR2 = getR2(thisDesign, data, fixedCols, hyp);
+		store.add(mod, thisR2, thisDim);
+	}
 
 	if (R_IsNaN(thisR2) == FALSE){
-		// log marginal likelihood
-		double thisVarLogMargLik = getVarLogMargLik(thisR2, data.nObs, thisDesign.Ncols(), hyp);
+		// log marginal likelihood, posterior expected g and shrinkage in one pass
+		const HypergResult thisHyperg = getVarLogMargLik(thisR2, thisDim, hyperg);
+		const double thisVarLogMargLik = thisHyperg.logBF;
 
 		// log prior
 		const double thisLogPrior = getVarLogPrior(mod, currFp, nUcGroups, hyp);
 
-		// posterior expected g
-		double thisPostExpectedg = posteriorExpectedg_hyperg(thisR2, data.nObs, thisDesign.Ncols(), hyp.a, thisVarLogMargLik);
-
-		// posterior expected shrinkage
-		double thisPostExpectedShrinkage = posteriorExpectedShrinkage_hyperg(thisR2, data.nObs, thisDesign.Ncols(), hyp.a, thisVarLogMargLik);
-
 		// put all this into the modelInfo
-		modelInfo info(thisVarLogMargLik, thisLogPrior, thisPostExpectedg, thisPostExpectedShrinkage, thisR2);
+		modelInfo info(thisVarLogMargLik, thisLogPrior, thisHyperg.postExpectedg, thisHyperg.postExpectedShrinkage, thisR2);
 
 		// altogether we have the model:
 		model thisModel = model(mod, info);
@@ -469,6 +700,254 @@ void computeModel(// compute (varying part of) marginal likelihood and prior of
 
 // ***************************************************************************************************//
 
+// propose a new model in the MCMC model search: "now" starts as a copy of the current model "old"
+// of the chain and is changed by a birth, death, move or switch step.
+// Returns the log proposal ratio.
+static double
+proposeModel(const modelmcmc& old,
+             modelmcmc& now,
+             const fpInfo& currFp,
+             const ucGroupSizes& ucGroups,
+             const unsigned int maxDim,
+             const unsigned int fixedDim,
+             const ProposalWeights& proposal,
+             RngStream& rng)
+{
+	double logPropRatio; // log proposal ratio
+	// randomly select move type
+	double u1 = rng.unif();
+	if (u1 < old.birthprob){											// BIRTH
+		unsigned int newCovInd = proposal.drawBirthCov(old.freeCovs, rng);
+		if (newCovInd <= currFp.nFps){ 					// some fp index
+			int powerIndex = proposal.drawPower(newCovInd, rng);
+			now.modPar.fpPars.at(newCovInd-1).insert(powerIndex);
+			now.modPar.fpSize++; // correct invariants
+			now.dim++;
+			now.updateFreeUcs(ucGroups, maxDim, old.dim, 0);
+			unsigned int newPowersEqualPowerIndex = count(now.modPar.fpPars.at(newCovInd-1).begin(), now.modPar.fpPars.at(newCovInd-1).end(), powerIndex);
+			unsigned int m = old.modPar.fpPars.at(newCovInd-1).size();
+			logPropRatio = log(static_cast<double>(newPowersEqualPowerIndex)) +
+			              log(proposal.powerWeightSum(newCovInd)) -
+			              log(proposal.powerWeight(newCovInd, powerIndex)) -
+			              log1p(static_cast<double>(m));
+		} else { 													// uc index
+			int index = discreteUniform(old.freeUcs, rng);
+			now.modPar.ucPars.insert(index);
+			now.modPar.ucSize++;
+			now.dim += ucGroups.sizes.at(index - 1);
+			now.updateFreeUcs(ucGroups, maxDim, old.dim, index);
+			logPropRatio = log(static_cast<double>(old.freeUcs.size())) -
+			        log(static_cast<double>(now.modPar.ucSize));
+		}
+		now.presentCovs.insert(newCovInd);
+		now.updateFreeCovs(currFp, maxDim, old.dim, newCovInd);
+		if (now.dim == maxDim){
+			now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3 : 0.5;
+		} else {
+			now.birthprob = now.deathprob =	now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
+		}
+		logPropRatio += log(now.deathprob) - log(old.birthprob) +
+		            log(proposal.birthWeightSum(old.freeCovs)) - log(proposal.birthWeight(newCovInd)) -
+		                log(proposal.deathWeightSum(now.presentCovs)) + log(proposal.deathWeight(newCovInd));
+	} else if (u1 < old.birthprob + old.deathprob){					// DEATH
+		unsigned int oldCovInd = proposal.drawDeathCov(old.presentCovs, rng);
+		if (oldCovInd <= currFp.nFps){ 					// some fp index
+			Powers::iterator powerIterator = dU<Powers >(now.modPar.fpPars.at(oldCovInd-1), rng);
+			const int oldPowerIndex = *powerIterator;
+			unsigned int oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(oldCovInd-1).begin(), old.modPar.fpPars.at(oldCovInd-1).end(), *powerIterator);
+			now.modPar.fpPars.at(oldCovInd-1).erase(powerIterator);
+			now.modPar.fpSize--; // correct invariants
+			now.dim--;
+			now.updateFreeUcs(ucGroups, maxDim, old.dim, 0);
+			logPropRatio = - log(static_cast<double>(oldPowersEqualPowerIndex)) -
+			              log(proposal.powerWeightSum(oldCovInd)) +
+			              log(proposal.powerWeight(oldCovInd, oldPowerIndex)) +
+			                  log(static_cast<double>(old.modPar.fpPars.at(oldCovInd-1).size()));
+		} else { 													// uc index
+			set<int>::iterator IndIterator = dU<set<int> >(now.modPar.ucPars, rng);
+			const int oldIndex = *IndIterator;
+			now.modPar.ucSize--;
+			now.dim -= ucGroups.sizes.at(oldIndex - 1);
+			now.modPar.ucPars.erase(IndIterator);
+			now.updateFreeUcs(ucGroups, maxDim, old.dim, oldIndex);
+			logPropRatio = log(static_cast<double>(old.modPar.ucSize)) -
+			        log(static_cast<double>(now.freeUcs.size()));
+		}
+		now.updatePresentCov(oldCovInd);
+		now.updateFreeCovs(currFp, maxDim, old.dim, oldCovInd);
+		if (now.dim == fixedDim){
+			now.birthprob = 1; now.deathprob = now.moveprob = 0;
+		} else {
+			now.birthprob = now.deathprob =	now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
+		}
+		logPropRatio += log(now.birthprob) - log(old.deathprob) +
+		            log(proposal.deathWeightSum(old.presentCovs)) - log(proposal.deathWeight(oldCovInd)) -
+		                log(proposal.birthWeightSum(now.freeCovs)) + log(proposal.birthWeight(oldCovInd));
+
+	} else if (u1 < old.birthprob + old.deathprob + old.moveprob){	 // MOVE
+		unsigned int CovInd = discreteUniform(old.presentCovs, rng);
+		if (CovInd <= currFp.nFps){ 						// some fp index
+			Powers::iterator powerIterator = dU<Powers >(now.modPar.fpPars.at(CovInd-1), rng);
+			const int oldPowerIndex = *powerIterator;
+			unsigned int oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(CovInd-1).begin(), old.modPar.fpPars.at(CovInd-1).end(), oldPowerIndex);
+			now.modPar.fpPars.at(CovInd-1).erase(powerIterator);
+			int powerIndex = proposal.drawPower(CovInd, rng);
+			now.modPar.fpPars.at(CovInd-1).insert(powerIndex);
+			unsigned int newPowersEqualPowerIndex = count(now.modPar.fpPars.at(CovInd-1).begin(), now.modPar.fpPars.at(CovInd-1).end(), powerIndex);
+			// free, present Covs and move type probs are unchanged
+			logPropRatio = log(static_cast<double>(newPowersEqualPowerIndex)) -
+			        log(static_cast<double>(oldPowersEqualPowerIndex)) +
+			        log(proposal.powerWeight(CovInd, oldPowerIndex)) -
+			        log(proposal.powerWeight(CovInd, powerIndex));
+
+		} else { 													// uc index
+			set<int>::iterator IndIterator = dU<set<int> >(now.modPar.ucPars, rng);
+			const int oldIndex = *IndIterator;
+			now.modPar.ucSize--;
+			now.dim -= ucGroups.sizes.at(oldIndex - 1);
+			now.modPar.ucPars.erase(IndIterator);
+			now.updateFreeUcs(ucGroups, maxDim, old.dim, oldIndex);
+			int index = discreteUniform(now.freeUcs, rng);
+			const unsigned int reducedDim = now.dim;
+			now.modPar.ucPars.insert(index);
+			now.modPar.ucSize++;
+			now.dim += ucGroups.sizes.at(index - 1);
+			now.updateFreeUcs(ucGroups, maxDim, reducedDim, index);
+			// here something may change, therefore:
+			now.updateFreeCovs(currFp, maxDim, old.dim, 0);
+			if (now.dim == maxDim){
+				now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3 : 0.5;
+			} else {
+				now.birthprob = now.deathprob =	now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
+			}
+			logPropRatio = 0.0;
+		}
+	} else {													// SWITCH (of FP vectors)
+		// select only from the FP present covs,
+		// so we have the first power vector:
+		unsigned int firstFpInd = discreteUniform(old.presentCovs, rng, currFp.nFps + 1);
+		Powers first = now.modPar.fpPars.at(firstFpInd - 1);
+
+		// the second power vector from all other FPs
+		unsigned int secondFpInd = discreteUniform(1, currFp.nFps, rng);
+		if (secondFpInd >= firstFpInd)
+			secondFpInd++;
+		Powers second = now.modPar.fpPars.at(secondFpInd - 1);
+
+		// save the first
+		Powers saveFirst = first;
+
+		// copy second to first
+		now.modPar.fpPars.at(firstFpInd - 1) = second;
+
+		// and save to second
+		now.modPar.fpPars.at(secondFpInd - 1) = saveFirst;
+
+		// so now we have switched the power vectors.
+
+		// move type probs are not changed, because the number of present FPs is unchanged,
+		// as well as the dimension of the model.
+
+		// but carefully update the information which covariates are free and which are present
+		now.updatePresentCov(firstFpInd);
+		now.updatePresentCov(secondFpInd);
+		now.updateFreeCovs(currFp, maxDim, old.dim, firstFpInd, secondFpInd);
+
+		// and the proposal ratio is 1, thus the log proposal ratio is 0:
+		logPropRatio = 0;
+	}
+
+	return logPropRatio;
+}
+
+// ***************************************************************************************************//
+
+// one replica of the population in the parallel tempering sampler
+struct Replica
+{
+	Replica(const modelmcmc& old, double beta, const RngStream& rng) :
+		old(old), now(old), beta(beta), rng(rng)
+	{
+	}
+
+	// the current and the proposed model
+	modelmcmc old, now;
+
+	// the inverse temperature: the replica samples from the posterior to this power
+	double beta;
+
+	// the own random number stream
+	RngStream rng;
+};
+
+// ***************************************************************************************************//
+
+// write the state of the model sampler after t iterations to the checkpoint file:
+// the counters, the replicas with their random number streams, the proposal weights,
+// the diagnostics and all cached models.
+static void
+saveSampler(const CheckpointOptions& options,
+            const DoubleVector& fingerprint,
+            PosLargeInt t,
+            const book& bookkeep,
+            const vector<Replica>& replicas,
+            const RngStream& swapRng,
+            const ProposalWeights& proposal,
+            const ChainDiagnostics& diagnostics,
+            const ModelCache& modelCache)
+{
+	CheckpointWriter checkpoint(options.fileName, fingerprint);
+
+	checkpoint.write(t);
+	checkpoint.write(bookkeep.nanCounter);
+
+	for(vector<Replica>::const_iterator r = replicas.begin(); r != replicas.end(); ++r){
+		r->old.save(checkpoint);
+		r->rng.save(checkpoint);
+	}
+	swapRng.save(checkpoint);
+
+	proposal.save(checkpoint);
+	diagnostics.save(checkpoint);
+	modelCache.save(checkpoint);
+
+	checkpoint.commit();
+}
+
+// restore the state of the model sampler from the checkpoint file,
+// and return the number of iterations done so far
+static PosLargeInt
+restoreSampler(const CheckpointOptions& options,
+               const DoubleVector& fingerprint,
+               book& bookkeep,
+               vector<Replica>& replicas,
+               RngStream& swapRng,
+               ProposalWeights& proposal,
+               ChainDiagnostics& diagnostics,
+               ModelCache& modelCache)
+{
+	CheckpointReader checkpoint(options.fileName, fingerprint);
+
+	PosLargeInt t;
+	checkpoint.read(t);
+	checkpoint.read(bookkeep.nanCounter);
+
+	for(vector<Replica>::iterator r = replicas.begin(); r != replicas.end(); ++r){
+		r->old.restore(checkpoint);
+		r->now = r->old;
+		r->rng.restore(checkpoint);
+	}
+	swapRng.restore(checkpoint);
+
+	proposal.restore(checkpoint);
+	diagnostics.restore(checkpoint);
+	modelCache.restore(checkpoint);
+
+	return t;
+}
+
+// ***************************************************************************************************//
+
 SEXP
 samplingGaussian(// definition
                  SEXP R_x, // design matrix (with colnames)
@@ -487,19 +966,35 @@ samplingGaussian(// definition
                  SEXP R_nModels, // number of best models to be returned
                  SEXP R_verbose, // should progress been displayed?
                  SEXP R_chainlength, // how many times should a jump been made?
-                 SEXP R_nCache) // size of models cache (an STL map)
+                 SEXP R_nCache, // size of models cache (an STL map)
+                 SEXP R_legacyRng, // use R's random number generator directly?
+                 SEXP R_adaptationLength, // how many jumps for learning the proposal weights?
+                 SEXP R_temperatures, // temperature ladder for parallel tempering
+                 SEXP R_swapInterval, // how many jumps between the replica swaps?
+                 SEXP R_checkpointFile, // where to save checkpoints ("" for none)?
+                 SEXP R_checkpointInterval, // how many jumps between the checkpoints?
+                 SEXP R_resume, // continue the chain from the checkpoint?
+                 SEXP R_modelStoreFile, // where to store the computed models ("" for none)?
+                 SEXP R_modelStoreKey, // fingerprint of the model search for the store
+                 SEXP R_sufficientStats, // sufficient statistics of the out-of-core data (or NULL)
+                 SEXP R_anytime) // maximum seconds and model evaluations, epsilon and window for convergence
 {
+	BEGIN_RCPP
 	// important!!! We now assume that all elements of R_fpmaxs are identical!!!
 	// It would be best to remove the option supporting different maximum FP degrees from the code,
 	// to be inline with the paper.
 
 	// unpack ###
 	// data
-	const Matrix x = getMatrix(R_x);
-	const Matrix xcentered = getMatrix(R_xcentered);
-	const ColumnVector y = vec2col(R_y);
+	// (views of the R memory, nothing is copied)
+	const AMatrix x = shareMatrix(R_x);
+	const AMatrix xcentered = shareMatrix(R_xcentered);
+	const AVector y = shareVector(R_y);
 
-	dataValues data(x, xcentered, y, 0); // totalNumber is not needed
+	// sufficient statistics, if the data are out-of-core and x, xcentered and y are empty
+	const SufficientStats stats(R_sufficientStats);
+
+	dataValues data(x, xcentered, y, 0, stats.active() ? &stats : 0); // totalNumber is not needed
 
 	// fp info
 	fpInfo currentFpInfo(R_nFps,
@@ -509,10 +1004,6 @@ samplingGaussian(// definition
 	                     R_fpnames,
 	                     x);
 
-	// the FP range
-	const std::set<unsigned int> fpRange = constructSequence(currentFpInfo.nFps);
-
-
 	// uc info
 	const int* ucIndicesArray = INTEGER(R_ucIndices);
 	const vector<int> ucIndices(ucIndicesArray, ucIndicesArray + Rf_length(R_ucIndices));
@@ -580,8 +1071,8 @@ samplingGaussian(// definition
 	// upper limit for num of columns
 	unsigned int maxDim = min(static_cast<unsigned int>(data.nObs), fixedDim + currentFpInfo.maxFpDim + maxUcDim);
 
-	// theta and theta':
-	modelmcmc old, now;
+	// theta:
+	modelmcmc old;
 
 	// start model
 	modelPar startModel(currentFpInfo.nFps, 0, 0);
@@ -589,257 +1080,294 @@ samplingGaussian(// definition
 	startModel.fpPars = startFps;
 	old.modPar = startModel;
 	old.dim = fixedDim;
-	old.freeUcs = getFreeUcs(old.modPar, ucSizes, old.dim, maxDim);
-	old.freeCovs = getFreeCovs(old.modPar, currentFpInfo, old.freeUcs, old.dim, maxDim);
-	old.presentCovs = getPresentCovs(old.modPar);
+	old.initIndexSets(currentFpInfo.nFps, ucSizes.size());
+	const ucGroupSizes ucGroups(ucSizes);
+	old.initFreeSets(ucGroups, currentFpInfo, maxDim);
 	old.birthprob = 1; old.deathprob = old.moveprob = 0;
 
-	Matrix oldDesign = getDesignMatrix(old.modPar, data, currentFpInfo, ucTermList, nUcGroups, fixedCols);
-	double oldR2 = getR2(oldDesign, data, fixedCols, hyp);
+	// hyper-g evaluation engine for this sample size and hyperparameter
+	HypergEngine hyperg(data.nObs, hyp.a);
 
-	// log marginal likelihood
-	old.logMargLik = getVarLogMargLik(oldR2, data.nObs, oldDesign.Ncols(), hyp);
+	int oldDim;
+	double oldR2 = getModelR2(old.modPar, data, currentFpInfo, ucTermList, nUcGroups, fixedCols, hyp, oldDim);
+
+	// log marginal likelihood, posterior expected g and shrinkage
+	const HypergResult oldHyperg = getVarLogMargLik(oldR2, oldDim, hyperg);
+	old.logMargLik = oldHyperg.logBF;
 
 	// log prior
         old.logPrior = getVarLogPrior(old.modPar, currentFpInfo, nUcGroups, hyp);
 
-	// posterior expected g
-	double oldPostExpectedg = posteriorExpectedg_hyperg(oldR2, data.nObs, oldDesign.Ncols(), hyp.a, old.logMargLik);
-
-	// posterior expected shrinkage
-	double oldPostExpectedShrinkage = posteriorExpectedShrinkage_hyperg(oldR2, data.nObs, oldDesign.Ncols(), hyp.a, old.logMargLik);
-
 	// insert this model into map container
-	modelInfo startInfo(old.logMargLik, old.logPrior, oldPostExpectedg, oldPostExpectedShrinkage, oldR2, 1);
+	modelInfo startInfo(old.logMargLik, old.logPrior, oldHyperg.postExpectedg, oldHyperg.postExpectedShrinkage, oldR2, 1);
 	modelCache.insert(old.modPar, startInfo);
 
-	// start with this model config
-	now = old;
+	// the proposal weights, which are adapted during the first adaptationLength iterations,
+	// and the efficiency diagnostics of the chain
+	const PosLargeInt adaptationLength = static_cast<PosLargeInt>(REAL(R_adaptationLength)[0]);
+	ProposalWeights proposal(PosIntVector(currentFpInfo.fpcards, currentFpInfo.fpcards + currentFpInfo.nFps),
+	                         adaptationLength);
+	ChainDiagnostics diagnostics(bookkeep.chainlength, adaptationLength, Rf_length(R_temperatures));
+
+	// the anytime mode: the chain can stop before chainlength iterations when a budget is
+	// exhausted or the inclusion probabilities of the FPs and UC groups have converged
+	const DoubleVector anytime = getDoubleVector(R_anytime);
+	AnytimeStop anytimeStop(anytime.at(0), anytime.at(1), anytime.at(2),
+	                        static_cast<PosLargeInt>(anytime.at(3)), currentFpInfo.nFps + nUcGroups);
+	vector<bool> included(currentFpInfo.nFps + nUcGroups);
+	PosLargeInt nEvaluations = 0;
+
+	RngStream rng = getRngStream(LOGICAL(R_legacyRng)[0]);
+
+	// the replicas for parallel tempering: replica r samples from the posterior to the power
+	// 1 / temperatures[r], and all start with this model config. Replica 0 is the cold chain at
+	// temperature 1, and only its visits are counted in the model cache and used for learning the
+	// proposal weights. All replicas share the model cache, so each model is evaluated only once.
+	// With only the cold chain, this is the usual sampler.
+	const DoubleVector temperatures = getDoubleVector(R_temperatures);
+	const PosInt nReplicas = temperatures.size();
+	const PosLargeInt swapInterval = static_cast<PosLargeInt>(REAL(R_swapInterval)[0]);
+
+	vector<Replica> replicas;
+	replicas.reserve(nReplicas);
+	for(PosInt r = 0; r != nReplicas; ++r){
+		replicas.push_back(Replica(old, 1.0 / temperatures[r], (r == 0) ? rng : rng.split(r)));
+	}
+
+	// the stream for the swap moves between the replicas
+	RngStream swapRng = rng.split(nReplicas);
+
+	// the proposal ratios, cache entries, R^2 values and dimensions of the proposed models,
+	// and whether the latter were found in the model store
+	DoubleVector logPropRatios(nReplicas);
+	vector<modelInfo> nowInfos(nReplicas);
+	DoubleVector nowR2s(nReplicas);
+	vector<int> nowDims(nReplicas);
+	vector<bool> nowStored(nReplicas);
+
+	// for each replica, the first replica which proposed the same new model in this iteration
+	vector<PosInt> duplicateOf(nReplicas);
+
+	// the persistent store of the models computed in earlier runs
+	ModelStore store(getStringVector(R_modelStoreFile).at(0), R_modelStoreKey);
+
+	// checkpoints of the sampler state
+	const CheckpointOptions checkpoint(getStringVector(R_checkpointFile).at(0),
+	                                   static_cast<PosLargeInt>(REAL(R_checkpointInterval)[0]),
+	                                   LOGICAL(R_resume)[0]);
+
+	// the fingerprint of this model search, which a checkpoint must match for resuming
+	DoubleVector fingerprint;
+	fingerprint.push_back(data.nObs);
+	fingerprint.push_back(arma::accu(data.design));
+	fingerprint.push_back(arma::accu(data.response));
+	if (stats.active())
+		fingerprint.push_back(arma::accu(stats.gram));
+	fingerprint.push_back(currentFpInfo.nFps);
+	fingerprint.insert(fingerprint.end(), currentFpInfo.fpcards, currentFpInfo.fpcards + currentFpInfo.nFps);
+	fingerprint.insert(fingerprint.end(), currentFpInfo.fpmaxs, currentFpInfo.fpmaxs + currentFpInfo.nFps);
+	fingerprint.insert(fingerprint.end(), ucSizes.begin(), ucSizes.end());
+	fingerprint.push_back(hyp.a);
+	fingerprint.push_back(old.logPrior);
+	fingerprint.push_back(adaptationLength);
+	fingerprint.insert(fingerprint.end(), temperatures.begin(), temperatures.end());
+	fingerprint.push_back(swapInterval);
+	fingerprint.push_back(rng.isLegacy());
+
+	// number of iterations done so far
+	PosLargeInt t = 0;
+
+	// continue a chain from the checkpoint?
+	if (checkpoint.resume){
+		t = restoreSampler(checkpoint, fingerprint, bookkeep, replicas, swapRng, proposal, diagnostics, modelCache);
+
+		if (t > bookkeep.chainlength)
+			Rcpp::stop("the checkpointed chain has already more iterations than chainlength");
+
+		if (bookkeep.verbose)
+			Rprintf("\nResuming the chain after %lu iterations\n", t);
+	}
 
 	// Start MCMC sampler***********************************************************//
-	GetRNGstate(); // use R's random number generator
-	for(PosLargeInt t = 0; t != bookkeep.chainlength; /* ++t explicitly at the end */){
-		double logPropRatio; // log proposal ratio
-		// randomly select move type
-		double u1 = unif_rand();
-		if (u1 < old.birthprob){											// BIRTH
-			unsigned int newCovInd = discreteUniform<unsigned int>(old.freeCovs);
-			if (newCovInd <= currentFpInfo.nFps){ 					// some fp index
-				int powerIndex = discreteUniform(0, currentFpInfo.fpcards[newCovInd-1]);
-				now.modPar.fpPars.at(newCovInd-1).insert(powerIndex);
-				now.modPar.fpSize++; // correct invariants
-				now.dim++;
-				unsigned int newPowersEqualPowerIndex = count(now.modPar.fpPars.at(newCovInd-1).begin(), now.modPar.fpPars.at(newCovInd-1).end(), powerIndex);
-				unsigned int m = old.modPar.fpPars.at(newCovInd-1).size();
-				logPropRatio = log(static_cast<double>(newPowersEqualPowerIndex)) +
-				              log(static_cast<double>(currentFpInfo.fpcards[newCovInd-1])) -
-				              log1p(static_cast<double>(m));
-			} else { 													// uc index
-				int index = discreteUniform<int>(old.freeUcs);
-				now.modPar.ucPars.insert(index);
-				now.modPar.ucSize++;
-				now.dim += ucSizes.at(index - 1);
-				now.freeUcs = getFreeUcs(now.modPar, ucSizes, now.dim, maxDim);
-				logPropRatio = log(static_cast<double>(old.freeUcs.size())) -
-				        log(static_cast<double>(now.modPar.ucSize));
-			}
-			now.presentCovs.insert(newCovInd);
-			now.freeCovs = getFreeCovs(now.modPar, currentFpInfo, now.freeUcs, now.dim, maxDim);
-			if (now.dim == maxDim){
-				now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3 : 0.5;
-			} else {
-				now.birthprob = now.deathprob =	now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
-			}
-			logPropRatio += log(now.deathprob) - log(old.birthprob) +
-			            log(static_cast<double>(old.freeCovs.size())) -
-			                log(static_cast<double>(now.presentCovs.size()));
-		} else if (u1 < old.birthprob + old.deathprob){					// DEATH
-			unsigned int oldCovInd = discreteUniform<unsigned int>(old.presentCovs);
-			if (oldCovInd <= currentFpInfo.nFps){ 					// some fp index
-				Powers::iterator powerIterator = dU<Powers >(now.modPar.fpPars.at(oldCovInd-1));
-				unsigned int oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(oldCovInd-1).begin(), old.modPar.fpPars.at(oldCovInd-1).end(), *powerIterator);
-				now.modPar.fpPars.at(oldCovInd-1).erase(powerIterator);
-				now.modPar.fpSize--; // correct invariants
-				now.dim--;
-				logPropRatio = - log(static_cast<double>(oldPowersEqualPowerIndex)) -
-				              log(static_cast<double>(currentFpInfo.fpcards[oldCovInd-1])) +
-				                  log(static_cast<double>(old.modPar.fpPars.at(oldCovInd-1).size()));
-			} else { 													// uc index
-				set<int>::iterator IndIterator = dU<set<int> >(now.modPar.ucPars);
-				now.modPar.ucSize--;
-				now.dim -= ucSizes.at(*IndIterator - 1);
-				now.modPar.ucPars.erase(IndIterator);
-				now.freeUcs = getFreeUcs(now.modPar, ucSizes, now.dim, maxDim);
-				logPropRatio = log(static_cast<double>(old.modPar.ucSize)) -
-				        log(static_cast<double>(now.freeUcs.size()));
-			}
-			now.presentCovs = getPresentCovs(now.modPar);
-			now.freeCovs = getFreeCovs(now.modPar, currentFpInfo, now.freeUcs, now.dim, maxDim);
-			if (now.dim == fixedDim){
-				now.birthprob = 1; now.deathprob = now.moveprob = 0;
-			} else {
-				now.birthprob = now.deathprob =	now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
-			}
-			logPropRatio += log(now.birthprob) - log(old.deathprob) +
-			            log(static_cast<double>(old.presentCovs.size())) -
-			                log(static_cast<double>(now.freeCovs.size()));
-
-		} else if (u1 < old.birthprob + old.deathprob + old.moveprob){	 // MOVE
-			unsigned int CovInd = discreteUniform<unsigned int>(old.presentCovs);
-			if (CovInd <= currentFpInfo.nFps){ 						// some fp index
-				Powers::iterator powerIterator = dU<Powers >(now.modPar.fpPars.at(CovInd-1));
-				unsigned int oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(CovInd-1).begin(), old.modPar.fpPars.at(CovInd-1).end(), *powerIterator);
-				now.modPar.fpPars.at(CovInd-1).erase(powerIterator);
-				int powerIndex = discreteUniform(0, currentFpInfo.fpcards[CovInd-1]);
-				now.modPar.fpPars.at(CovInd-1).insert(powerIndex);
-				unsigned int newPowersEqualPowerIndex = count(now.modPar.fpPars.at(CovInd-1).begin(), now.modPar.fpPars.at(CovInd-1).end(), powerIndex);
-				// free, present Covs and move type probs are unchanged
-				logPropRatio = log(static_cast<double>(newPowersEqualPowerIndex)) -
-				        log(static_cast<double>(oldPowersEqualPowerIndex));
-
-			} else { 													// uc index
-				set<int>::iterator IndIterator = dU<set<int> >(now.modPar.ucPars);
-				now.modPar.ucSize--;
-				now.dim -= ucSizes.at(*IndIterator - 1);
-				now.modPar.ucPars.erase(IndIterator);
-				now.freeUcs = getFreeUcs(now.modPar, ucSizes, now.dim, maxDim);
-				int index = discreteUniform<int>(now.freeUcs);
-				now.modPar.ucPars.insert(index);
-				now.modPar.ucSize++;
-				now.dim += ucSizes.at(index - 1);
-				now.freeUcs = getFreeUcs(now.modPar, ucSizes, now.dim, maxDim);
-				// here something may change, therefore:
-				now.freeCovs = getFreeCovs(now.modPar, currentFpInfo, now.freeUcs, now.dim, maxDim);
-				if (now.dim == maxDim){
-					now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3 : 0.5;
-				} else {
-					now.birthprob = now.deathprob =	now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
+	GetRNGstate(); // use R's random number generator (only needed for the legacy stream)
+	for(; t != bookkeep.chainlength; /* ++t explicitly at the end */){
+		// propose a new model in each replica, and look it up in the model cache
+		// and then in the model store
+		for(PosInt r = 0; r != nReplicas; ++r){
+			Replica& rep = replicas[r];
+			logPropRatios[r] = proposeModel(rep.old, rep.now, currentFpInfo, ucGroups, maxDim, fixedDim,
+			                                proposal, rep.rng);
+			nowInfos[r] = modelCache.getModelInfo(rep.now.modPar);
+			nowStored[r] = R_IsNA(nowInfos[r].logMargLik) &&
+			        store.find(rep.now.modPar, nowR2s[r], nowDims[r]);
+
+			// is the same new model already computed for a colder replica?
+			duplicateOf[r] = r;
+			if (R_IsNA(nowInfos[r].logMargLik) && ! nowStored[r]){
+				for(PosInt s = 0; s != r; ++s){
+					if ((duplicateOf[s] == s) && R_IsNA(nowInfos[s].logMargLik) && ! nowStored[s] &&
+					    ! (replicas[s].now.modPar < rep.now.modPar) && ! (rep.now.modPar < replicas[s].now.modPar)){
+						duplicateOf[r] = s;
+						break;
+					}
 				}
-				logPropRatio = 0.0;
 			}
-		} else {													// SWITCH (of FP vectors)
-			// select only the FP present covs
-			std::set<unsigned int> presentFps = removeElement(old.presentCovs, currentFpInfo.nFps + 1);
+		}
 
-			// so we have the first power vector:
-			unsigned int firstFpInd = discreteUniform<unsigned int>(presentFps);
-			Powers first = now.modPar.fpPars.at(firstFpInd - 1);
+		// for the new models, construct the design matrices and compute the R^2 values,
+		// one replica per thread, and each model only once
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(nReplicas > 1)
+#endif
+		for(int r = 0; r < static_cast<int>(nReplicas); ++r){
+			if (R_IsNA(nowInfos[r].logMargLik) && ! nowStored[r] && (duplicateOf[r] == static_cast<PosInt>(r))){
+				nowR2s[r] = getModelR2(replicas[r].now.modPar, data, currentFpInfo,
+				                       ucTermList, nUcGroups, fixedCols, hyp, nowDims[r]);
+			}
+		}
+		for(PosInt r = 0; r != nReplicas; ++r){
+			nowR2s[r] = nowR2s[duplicateOf[r]];
+			nowDims[r] = nowDims[duplicateOf[r]];
+		}
 
-			// the second power vector from all other FPs
-			std::set<unsigned int> otherFps = removeElement(fpRange, firstFpInd);
-			unsigned int secondFpInd = discreteUniform<unsigned int>(otherFps);
-			Powers second = now.modPar.fpPars.at(secondFpInd - 1);
+		// the rest uses R's API and the shared caches, so it is done serially
+		bool coldAccepted = false;
+		for(PosInt r = 0; r != nReplicas; ++r){
+			Replica& rep = replicas[r];
+			modelmcmc& now = rep.now;
 
-			// save the first
-			Powers saveFirst = first;
+			// a duplicate is in the model cache now, if the colder replica has inserted it
+			if (duplicateOf[r] != r)
+				nowInfos[r] = modelCache.getModelInfo(now.modPar);
 
-			// copy second to first
-			now.modPar.fpPars.at(firstFpInd - 1) = second;
+			if (R_IsNA(nowInfos[r].logMargLik))
+			{ // "now" is a new model
 
-			// and save to second
-			now.modPar.fpPars.at(secondFpInd - 1) = saveFirst;
+				// (this does nothing if it was found in the store)
+				store.add(now.modPar, nowR2s[r], nowDims[r]);
+				if (! nowStored[r] && (duplicateOf[r] == r))
+					nEvaluations++;
 
-			// so now we have switched the power vectors.
+				if (R_IsNaN(nowR2s[r]))
+				{ // check if new model is OK, if not then nan
+					now.logMargLik = R_NaN;
 
-			// move type probs are not changed, because the number of present FPs is unchanged,
-			// as well as the dimension of the model.
+					// we do not save this model in the model cache
+					bookkeep.nanCounter++;
+				}
+				else
+				{ // OK: then compute the rest, and insert into model cache
+
+					// log marginal likelihood and log Bayes factor,
+					// posterior expected g and shrinkage
+					const HypergResult nowHyperg =
+					        getVarLogMargLik(nowR2s[r], nowDims[r], hyperg);
+					now.logMargLik = nowHyperg.logBF;
+
+					now.logPrior = getVarLogPrior(now.modPar, currentFpInfo, nUcGroups, hyp);
+
+					// insert the model parameter/info into the model cache
+
+					// problem: this could erase the old model from the model cache,
+					// and invalidate the iterator old.mapPos!
+					// ==> so we cannot work with the iterators here.
+					modelCache.insert(now.modPar,
+					                  modelInfo(now.logMargLik, now.logPrior,
+					                            nowHyperg.postExpectedg,
+					                            nowHyperg.postExpectedShrinkage,
+					                            nowR2s[r],
+					                            0));
+				}
+			}
+			else // "now" is an old model
+			{
+				// extract log marg lik and prior from the modelInfo object
+				now.logMargLik = nowInfos[r].logMargLik;
+				now.logPrior = nowInfos[r].logPrior;
+			}
 
-			// but carefully update the information which covariates are free and which are present
-			now.freeCovs = getFreeCovs(now.modPar, currentFpInfo, now.freeUcs, now.dim, maxDim);
-			now.presentCovs = getPresentCovs(now.modPar);
+			// decide acceptance at the temperature of the replica:
+			// for acceptance, the new model must be valid and the acceptance must be sampled
+			const bool accepted = (R_IsNaN(now.logMargLik) == FALSE) &&
+			    (rep.rng.unif() <= exp(rep.beta * (now.logMargLik - rep.old.logMargLik + now.logPrior - rep.old.logPrior) +
+			                           logPropRatios[r]));
+			if (accepted)
+			{ // acceptance
+				rep.old = now;
+			}
+			else
+			{ // rejection
+				now = rep.old;
+			}
 
-			// and the proposal ratio is 1, thus the log proposal ratio is 0:
-			logPropRatio = 0;
+			if (r == 0)
+				coldAccepted = accepted;
 		}
 
-		// search for log marg lik of proposed model
-		modelInfo nowInfo = modelCache.getModelInfo(now.modPar);
-
-		if (R_IsNA(nowInfo.logMargLik))
-		{ // "now" is a new model
-
-		    // construct design matrix and compute R^2
-		    Matrix nowDesign =
-		            getDesignMatrix(now.modPar, data, currentFpInfo,
-		                            ucTermList, nUcGroups, fixedCols);
-		    double nowR2 = getR2(nowDesign, data, fixedCols, hyp);
-
-		    if (R_IsNaN(nowR2))
-		    { // check if new model is OK, if not then nan
-		        now.logMargLik = R_NaN;
-
-		        // we do not save this model in the model cache
-		        bookkeep.nanCounter++;
-		    }
-		    else
-		    { // OK: then compute the rest, and insert into model cache
-
-		        // log marginal likelihood and log Bayes factor
-		        now.logMargLik = getVarLogMargLik(nowR2, data.nObs,
-		                                          nowDesign.Ncols(), hyp);
-
-		        now.logPrior = getVarLogPrior(now.modPar, currentFpInfo, nUcGroups, hyp);
-
-		        // posterior expected g
-		        double nowPostExpectedg =
-		                posteriorExpectedg_hyperg(nowR2, data.nObs,
-		                                          nowDesign.Ncols(), hyp.a,
-		                                          now.logMargLik);
-
-		        // posterior expected shrinkage
-		        double nowPostExpectedShrinkage =
-		                posteriorExpectedShrinkage_hyperg(nowR2,
-		                                                  data.nObs,
-		                                                  nowDesign.Ncols(),
-		                                                  hyp.a,
-		                                                  now.logMargLik);
-
-		        // insert the model parameter/info into the model cache
-
-		        // problem: this could erase the old model from the model cache,
-		        // and invalidate the iterator old.mapPos!
-		        // ==> so we cannot work with the iterators here.
-		        modelCache.insert(now.modPar,
-		                          modelInfo(now.logMargLik, now.logPrior,
-		                                    nowPostExpectedg,
-		                                    nowPostExpectedShrinkage,
-		                                    nowR2,
-		                                    0));
-		    }
-		}
-		else // "now" is an old model
-		{
-		    // extract log marg lik and prior from the modelInfo object
-		    now.logMargLik = nowInfo.logMargLik;
-		    now.logPrior = nowInfo.logPrior;
-		}
+		// every swapInterval iterations, propose to exchange the models
+		// of a random pair of neighbouring replicas
+		if ((nReplicas > 1) && ((t + 1) % swapInterval == 0)){
+			const PosInt i = discreteUniform(0, nReplicas - 1, swapRng);
+			Replica& colder = replicas[i];
+			Replica& hotter = replicas[i + 1];
+
+			const double logSwapRatio = (colder.beta - hotter.beta) *
+			        (hotter.old.logMargLik + hotter.old.logPrior - colder.old.logMargLik - colder.old.logPrior);
+
+			const bool swapped = (swapRng.unif() <= exp(logSwapRatio));
+			if (swapped){
+				std::swap(colder.old, hotter.old);
+				colder.now = colder.old;
+				hotter.now = hotter.old;
+			}
 
+			diagnostics.recordSwap(i, swapped);
+		}
 
-		// decide acceptance:
-		// for acceptance, the new model must be valid and the acceptance must be sampled
-                if ((R_IsNaN(now.logMargLik) == FALSE) &&
-                    (unif_rand() <= exp(now.logMargLik - old.logMargLik + now.logPrior - old.logPrior + logPropRatio)))
-                { // acceptance
-                    old = now;
-                }
-                else
-                { // rejection
-                    now = old;
-                }
+		// so now definitely old == now for the cold chain, and we can
+		// increment the associated sampling frequency.
+		const modelmcmc& cold = replicas[0].old;
+		modelCache.incrementFrequency(cold.modPar);
 
-                // so now definitely old == now, and we can
-                // increment the associated sampling frequency.
-                modelCache.incrementFrequency(now.modPar);
+		// learn the proposal weights and record the efficiency diagnostics
+		proposal.record(t, cold.modPar.fpPars, ! cold.modPar.ucPars.empty());
+		diagnostics.record(t, coldAccepted, cold.logMargLik + cold.logPrior, cold.dim);
 
-                // echo progress?
+		// echo progress?
 		if((++t % max(bookkeep.chainlength / 100, static_cast<PosLargeInt>(1)) == 0) &&
 		    bookkeep.verbose)
 		{
 			Rprintf("-"); // display computation progress at each percent
 		}
+
+		// stop early in the anytime mode?
+		if (anytimeStop.checksConvergence()){
+			for (PosInt i = 0; i != currentFpInfo.nFps; i++)
+				included[i] = ! cold.modPar.fpPars[i].empty();
+			for (int g = 1; g <= nUcGroups; g++)
+				included[currentFpInfo.nFps + g - 1] = cold.modPar.ucPars.count(g) > 0;
+		}
+		const bool stopNow = anytimeStop.stop(included, nEvaluations);
+
+		// write a checkpoint regularly, at the end of the chain and when it stops early
+		if (checkpoint.active() &&
+		    ((t % checkpoint.interval == 0) || (t == bookkeep.chainlength) || stopNow))
+		{
+			saveSampler(checkpoint, fingerprint, t, bookkeep, replicas, swapRng, proposal, diagnostics, modelCache);
+		}
+
+		if (stopNow)
+			break;
 	}
 	PutRNGstate(); // no RNs required anymore
 
+	// the sampling frequencies are relative to the iterations actually done,
+	// which are fewer than chainlength if the chain stopped early
+	const bool stoppedEarly = (t != bookkeep.chainlength);
+	bookkeep.chainlength = t;
+
+	// save the newly computed models for later runs
+	store.flush();
 
 	// normalize posterior probabilities and correct log marg lik
 	const long double logNormConst = modelCache.getLogNormConstant();
@@ -857,111 +1385,46 @@ samplingGaussian(// definition
 	Rf_setAttrib(ret, Rf_install("inclusionProbs"), putDoubleVector(modelCache.getInclusionProbs(logNormConst, currentFpInfo.nFps, nUcGroups)));
 	Rf_setAttrib(ret, Rf_install("linearInclusionProbs"), putDoubleVector(modelCache.getLinearInclusionProbs(logNormConst, currentFpInfo.nFps)));
 	Rf_setAttrib(ret, Rf_install("logNormConst"), Rf_ScalarReal(logNormConst));
+	Rf_setAttrib(ret, Rf_install("samplerDiagnostics"), diagnostics.convert2list());
+	Rf_setAttrib(ret, Rf_install("chainlength"), Rf_ScalarReal(t));
+	Rf_setAttrib(ret, Rf_install("stopReason"), Rf_mkString(anytimeStop.getReason().c_str()));
+	if (store.active())
+		Rf_setAttrib(ret, Rf_install("modelStore"), store.convert2list());
 
 	if (bookkeep.verbose){
-	    Rprintf("\nNumber of non-identifiable model proposals:     %lu", bookkeep.nanCounter);
-	    Rprintf("\nNumber of total cached models:                  %d", modelCache.size());
-	    Rprintf("\nNumber of returned models:                      %d\n", Rf_length(ret));
+		if (stoppedEarly)
+			Rprintf("\nChain stopped after %lu iterations (%s)", t, anytimeStop.getReason().c_str());
+		Rprintf("\nNumber of non-identifiable model proposals:     %lu", bookkeep.nanCounter);
+		Rprintf("\nNumber of total cached models:                  %d", modelCache.size());
+		Rprintf("\nNumber of returned models:                      %d\n", Rf_length(ret));
+
+		MemoryReport memory;
+		memory.add(data.design);
+		memory.add(data.centeredDesign);
+		memory.add(data.response);
+		memory.add(stats.gram);
+		memory.print();
 	}
 
 
 	// return ###
 	Rf_unprotect(1);
 	return ret;
-}
-
-// ***************************************************************************************************//
-
-set<int> getFreeUcs(	// compute set of free uc group indices
-					const modelPar& mod,
-					const vector<unsigned int>& ucSizes,
-					const unsigned int& currDim,
-					const unsigned int& maxDim
-					)
-{
-	set<int> ret;
-	for (int i = 1; i <= static_cast<int>(ucSizes.size()); i++){ // for every uc index
-		if ((find(mod.ucPars.begin(), mod.ucPars.end(), i) == mod.ucPars.end()) && (ucSizes.at(i-1) <= maxDim - currDim))
-			ret.insert(i); // insert if not already in model and enough space in design matrix
-	}
-	return ret;
-}
-
-
-// ***************************************************************************************************//
-
-set<unsigned int> getFreeCovs(					// compute set of free cov indices
-				const modelPar& mod,
-				const fpInfo& currFp,
-				const set<int>& freeUcs,
-				const unsigned int& currDim,
-				const unsigned int& maxDim
-					)
-{
-	set<unsigned int> ret;
-
-	if (currDim == maxDim)
-		return ret;
-
-	for (unsigned int i = 0; i != mod.nFps; i++){
-		if (mod.fpPars.at(i).size() < static_cast<PosInt>(currFp.fpmaxs[i]))
-			ret.insert(i + 1);
-	}
-
-	if (! freeUcs.empty())
-		ret.insert(mod.nFps + 1);
-
-	return ret;
-}
-
-// ***************************************************************************************************//
-
-
-set<unsigned int> getPresentCovs	( // determine set of present cov indices
-					const modelPar& mod
-						)
-{
-	set<unsigned int> ret;
-	for (unsigned int i = 0; i != mod.nFps; i++){
-		if (! mod.fpPars.at(i).empty())
-			ret.insert(i+1);
-	}
-	if (! mod.ucPars.empty())
-		ret.insert(mod.nFps + 1);
-	return ret;
-}
-
-// ***************************************************************************************************//
-
-
-template <class T>
-T discreteUniform (	// return random element of myset; should be enclosed in getRNGstate() etc.
-				const set<T>& myset
-					)
-{
-	if (myset.empty())
-		Rcpp::stop("\nmyset is empty!\n");
-
-	double u = unif_rand();
-	typename set<T>::size_type size = myset.size();
-	typename set<T>::const_iterator i = myset.begin(); typename set<T>::size_type j = 1;
-	while(u > 1.0 / size * j){
-		i++; j++;
-	}
-	return *i;
+	END_RCPP
 }
 
 // ***************************************************************************************************//
 
 template <class T>
 typename T::iterator dU (	// return iterator of random element of myset; should be enclosed in getRNGstate() etc.
-				const T& container
+				const T& container,
+				RngStream& rng
 					)
 {
 	if (container.empty())
 		Rcpp::stop("\ncontainer is empty!\n");
 
-	double u = unif_rand();
+	double u = rng.unif();
 	typename T::size_type size = container.size();
 	typename T::iterator i = container.begin(); typename T::size_type j = 1;
 	while(u > 1.0 / size * j){
@@ -975,7 +1438,8 @@ typename T::iterator dU (	// return iterator of random element of myset; should
 
 int discreteUniform ( // get random int x with lower <= x < upper; should be enclosed in getRNGstate() etc.
 						const int& lower,
-						const int& upper
+						const int& upper,
+						RngStream& rng
 					)
 {
 	if (lower >= upper)
@@ -983,7 +1447,7 @@ int discreteUniform ( // get random int x with lower <= x < upper; should be enc
 
 	int size = upper - lower;
 	int ret = lower;
-	double u = unif_rand();
+	double u = rng.unif();
 
 	while(u > 1.0 / size * (ret - lower + 1)){
 		ret++;
@@ -993,63 +1457,18 @@ int discreteUniform ( // get random int x with lower <= x < upper; should be enc
 
 // ***************************************************************************************************//
 
-ReturnMatrix getDesignMatrix ( // construct centered design matrix including intercept for the model
-					const modelPar &mod,
-					const dataValues &data,
-					const fpInfo &currFp,
-					const vector<IntSet>& ucTermList,
-					const int &nUcGroups,
-					const set<int> &fixedCols
-					)
-{
-//
-//	MATRIXSTORE(data.response, responseStore)
-//
-	// build design matrix B
-
-	// intercept column
-	Matrix B = data.onesVector;
-
-	// centered fp matrices
-	for (unsigned int i = 0; i != currFp.nFps; i++){
-		Powers powersi = mod.fpPars.at(i);
-		if (! powersi.empty()){
-			Matrix Fp = getFpMatrix(currFp.tcols.at(i), powersi, data); // this is centered
-			B = B | Fp;
-		}
-	}
-
-	// centered uc matrices
-	for (int i = 0; i != nUcGroups; i++){
-		set<int>::const_iterator ipos = find(mod.ucPars.begin(), mod.ucPars.end(), i + 1);
-		if (ipos != mod.ucPars.end()){ // if mod.ucPars contains i
-			Matrix Uc = getMultipleCols(data.centeredDesign, ucTermList.at(i));	// this is centered
-			B = B | Uc;
-		}
-	}
-
-	B.release();
-	return B;
-}
-
-
-
-
-// ***************************************************************************************************//
 
 double getR2(	// compute coefficient of determination for the model
-			const Matrix &design, // must be the centered design matrix!! (including the intercept)
+			const AMatrix &design, // must be the centered design matrix!! (including the intercept)
 			const dataValues &data,
 			const set<int> &fixedCols,
 			const hyperPriorPars &hyp
 			)
 {
 
-	int dim = design.Ncols();
+	int dim = design.n_cols;
 	if (dim - 1 >= data.nObs - 3 - hyp.a) return R_NaN; // not a valid model
-//
-//	MATRIXSTORE(B, BStore)
-//
+
 	const int numFixedCols = fixedCols.size();
 
 	if (dim == numFixedCols) { // then this is the null model
@@ -1057,58 +1476,71 @@ double getR2(	// compute coefficient of determination for the model
 	}
 	else {	// else we need to work a bit
 
-		// select nonfixed part of the centered design matrix, because the fixed part is not needed here
-		Matrix X = design.Columns(numFixedCols + 1, dim);
+		// select nonfixed part of the centered design matrix, because the fixed part is not needed here.
+		// The columns are contiguous in memory, so we can use the memory of design directly.
+		const AMatrix X(const_cast<double*>(design.colptr(numFixedCols)),
+		                design.n_rows,
+		                dim - numFixedCols,
+		                false,
+		                true);
 
-//		double test;
-//		MATRIXSTORE(X, XStore)
+		// compute the lower triangle of XtX
+		AMatrix XtX(X.n_cols, X.n_cols);
+		syrk(false, true, X, 0.0, XtX);
 
-		// compute model-specific parts
-		SymmetricMatrix XtX;
-		XtX << X.t() * X;
+		// a cholesky decomposition of XtX: if XtX is not p.d. then return NAN
+		if (potrf(false, XtX) != 0)
+		    return R_NaN;
 
-		try // a cholesky decomposition of XtX
-		{
-		    LowerTriangularMatrix LeftRootOfXtX = Cholesky(XtX);
+		// compute coefficient of determination R2:
+		// solve L * tmp = X' * y instead of inverting the left root L of XtX
+		AMatrix tmp = X.t() * data.response;
+		trs(false, false, XtX, tmp);
 
-//		    MATRIXSTORE(LeftRootOfXtX, lroxtxStore)
+		double sumOfSquaresModel = arma::accu(arma::square(tmp));
 
-		    // compute coefficient of determination R2
-		    ColumnVector tmp = LeftRootOfXtX.i() * (X.t() * data.response);
+		double R2 = sumOfSquaresModel / data.sumOfSquaresTotal;
 
-//		    MATRIXSTORE(tmp, tmpStore)
+		assert((R2 <= 1) & (R2 >= 0));
 
-		    double sumOfSquaresModel = tmp.sum_square();
+		return R2;
+	}
+}
 
-			double R2 = sumOfSquaresModel / data.sumOfSquaresTotal;
+// ***************************************************************************************************//
 
-			assert((R2 <= 1) & (R2 >= 0));
+double getModelR2(	// compute coefficient of determination and design matrix dimension for the model
+			const modelPar &mod,
+			const dataValues &data,
+			const fpInfo &currFp,
+			const vector<IntSet>& ucTermList,
+			const int &nUcGroups,
+			const set<int> &fixedCols,
+			const hyperPriorPars &hyp,
+			int &dim
+			)
+{
+	// out-of-core data: only the sufficient statistics are available
+	if (data.stats)
+		return data.stats->R2(mod, currFp, ucTermList, hyp, dim);
 
-			return R2;
-		}
-		catch(NPDException) {return R_NaN;} // if XtX is not p.d. then return NAN
-	}
+	AMatrix design = getDesignMatrix(mod, data, currFp, ucTermList, nUcGroups, fixedCols);
+	dim = design.n_cols;
+	return getR2(design, data, fixedCols, hyp);
 }
 
 // ***************************************************************************************************//
 
 // compute varying part of log marginal likelihood for specific model
-double getVarLogMargLik(const double &R2, const int &n, const int &dim, const hyperPriorPars &hyp)
+HypergResult getVarLogMargLik(const double &R2, const int &dim, HypergEngine &hyperg)
 {
     // check if any interrupt signals have been entered
     // (check here because this function is used both by the exhaustive and the sampling function)
     R_CheckUserInterrupt();
 
-    // then start computing
-	if(dim == 1){
-		return 0;
-	} else {
-
-		double logBF = logBF_hyperg(R2, n, dim, hyp.a);
-		assert(! ISNAN(logBF)); // each possible case has been treated above!
-
-		return logBF;
-	}
+    // then start computing (the null model case dim == 1 is handled by the engine,
+    // and a NaN R2 of a non-identifiable model gives NaN results, which the callers check)
+    return hyperg.evaluate(R2, dim);
 }
 
 // ***************************************************************************************************//
@@ -1187,39 +1619,6 @@ double getVarLogPrior( // compute varying part of logarithm of model prior
 
 // ***************************************************************************************************//
 
-ReturnMatrix getFpMatrix( // build Fp basis matrix from vector, power indices and power set for one covariate
-			const vector<ColumnVector> &tcols,
-			const Powers &powerinds,
-			const dataValues &data
-			)
-{
-	const int logInd = 3; // this index corresponds to power = 0, i.e. log.
-	const int nrow = tcols.at(0).Nrows();
-
-	Matrix ret(nrow, powerinds.size());
-
-	// start recursion
-	int lastInd = logInd;
-	ColumnVector lastCol(nrow); lastCol = 1;
-
-	// there is at least one power present
-	Powers::size_type cols = 1; // invariant: about to process column number cols
-
-	for (Powers::const_iterator now = powerinds.begin(); now != powerinds.end(); now++){
-		if (*now == lastInd){ 	// repeated powers case
-			lastCol = SP(lastCol, tcols.at(logInd));
-		} else {				// normal case
-			lastInd = *now;
-			lastCol = tcols.at(lastInd);
-		}
-		// center the column
-		ret.Column(cols++) = lastCol - (lastCol.sum() / data.nObs) * data.onesVector;
-	}
-
-	ret.Release(); return ret;
-}
-
-// ***************************************************************************************************//
 
 
 
@@ -1264,6 +1663,7 @@ SEXP logMargLik( //definition
 				SEXP R_sst				// total sum of squares computed from y
 				)
 {
+	BEGIN_RCPP
 	unsigned int nProtect = 0;
 
 	// unpack
@@ -1275,7 +1675,8 @@ SEXP logMargLik( //definition
 
 	// compute
 	hyperPriorPars hyp(alpha, std::string("flat")); // prior type does not matter here
-	double varLogMargLik = getVarLogMargLik(R2, n, dim, hyp);
+	HypergEngine hyperg(n, hyp.a);
+	double varLogMargLik = getVarLogMargLik(R2, dim, hyperg).logBF;
 	double logMargLikConst = - (n - 1) / 2.0 * log(sst)  - log(hyp.a - 2.0);
 
 	SEXP ret;
@@ -1284,6 +1685,7 @@ SEXP logMargLik( //definition
 
 	Rf_unprotect(nProtect);
 	return(ret);
+	END_RCPP
 }
 
 // ***************************************************************************************************//
@@ -1295,6 +1697,7 @@ SEXP postExpectedg( // definition
                 SEXP R_dim, // number of columns of the design matrix
                 SEXP R_alpha) // hyperparamater for hyper-g prior
 {
+    BEGIN_RCPP
     unsigned int nProtect = 0;
 
     // unpack
@@ -1305,8 +1708,8 @@ SEXP postExpectedg( // definition
 
     // compute
     hyperPriorPars hyp(alpha, std::string("flat")); // value of priorType does not matter here
-    const double varLogMargLik = getVarLogMargLik(R2, n, dim, hyp);
-    const double postExpectedg = posteriorExpectedg_hyperg(R2, n, dim, hyp.a, varLogMargLik);
+    HypergEngine hyperg(n, hyp.a);
+    const double postExpectedg = getVarLogMargLik(R2, dim, hyperg).postExpectedg;
 
     SEXP ret;
     Rf_protect(ret = Rf_ScalarReal(postExpectedg));
@@ -1314,6 +1717,7 @@ SEXP postExpectedg( // definition
 
     Rf_unprotect(nProtect);
     return(ret);
+    END_RCPP
 }
 
 // ***************************************************************************************************//
@@ -1325,6 +1729,7 @@ SEXP postExpectedShrinkage( //definition
                 SEXP R_dim, // number of columns of the design matrix
                 SEXP R_alpha) // hyperparamater for hyper-g prior
 {
+    BEGIN_RCPP
     unsigned int nProtect = 0;
 
     // unpack
@@ -1335,8 +1740,8 @@ SEXP postExpectedShrinkage( //definition
 
     // compute
     hyperPriorPars hyp(alpha, std::string("flat")); // value of priorType does not matter here
-    const double varLogMargLik = getVarLogMargLik(R2, n, dim, hyp);
-    const double postExpectedShrinkage = posteriorExpectedShrinkage_hyperg(R2, n, dim, hyp.a, varLogMargLik);
+    HypergEngine hyperg(n, hyp.a);
+    const double postExpectedShrinkage = getVarLogMargLik(R2, dim, hyperg).postExpectedShrinkage;
 
     SEXP ret;
     Rf_protect(ret = Rf_ScalarReal(postExpectedShrinkage));
@@ -1344,6 +1749,135 @@ SEXP postExpectedShrinkage( //definition
 
     Rf_unprotect(nProtect);
     return(ret);
+    END_RCPP
+}
+
+// ***************************************************************************************************//
+
+// this is an interface for R to time the hot kernels of the model search separately for random models:
+// the design matrix construction, getR2, the incremental R2 and the log marginal likelihood.
+SEXP kernelBenchmark( // definition
+                SEXP R_x, // design matrix
+                SEXP R_xcentered, // centered design matrix
+                SEXP R_y, // response vector
+                SEXP R_fpmaxs, // vector of maximum fp degrees
+                SEXP R_fppos, // corresponding vector of fp column indices
+                SEXP R_fpcards, // corresponding vector of power set cardinalities
+                SEXP R_nFps, // number of fp terms
+                SEXP R_fpnames, // names of fp terms
+                SEXP R_ucIndices, // vector giving _unc_ertainty custer indices (column -> which group)
+                SEXP R_ucTermList, // list for (group -> which columns) one-to-many mapping
+                SEXP R_nUcGroups, // number of uncertainty groups
+                SEXP R_hyperparam, // hyperparameter a for hyper-g prior
+                SEXP R_nModels) // number of random models to time
+{
+	BEGIN_RCPP
+	typedef std::chrono::steady_clock Clock;
+
+	// unpack
+	const AMatrix x = shareMatrix(R_x);
+	const AMatrix xcentered = shareMatrix(R_xcentered);
+	const AVector y = shareVector(R_y);
+
+	const hyperPriorPars hyp(Rf_asReal(R_hyperparam), std::string("flat")); // prior type does not matter here
+	const dataValues data(x, xcentered, y, 0.0);
+
+	fpInfo currentFpInfo(R_nFps,
+	                     R_fpcards,
+	                     R_fppos,
+	                     R_fpmaxs,
+	                     R_fpnames,
+	                     x);
+
+	const int nUcGroups = Rf_asInteger(R_nUcGroups);
+	vector<IntSet> ucTermList(nUcGroups);
+	for(R_len_t i = 0; i != Rf_length(R_ucTermList); i++) {
+		SEXP temp = VECTOR_ELT(R_ucTermList, i);
+		copy(INTEGER(temp), INTEGER(temp) + Rf_length(temp),
+		     inserter(ucTermList.at(i), ucTermList.at(i).begin()));
+	}
+
+	// the fixed columns, as in exhaustiveGaussian
+	set<int> nonfixedCols = set<int>(currentFpInfo.fppos, currentFpInfo.fppos + currentFpInfo.nFps);
+	set<int> allCols, fixedCols;
+	for(R_len_t i = 0; i != Rf_length(R_ucIndices); i++){
+		allCols.insert(i + 1);
+		if (INTEGER(R_ucIndices)[i])
+			nonfixedCols.insert(i + 1);
+	}
+	set_difference(allCols.begin(), allCols.end(), nonfixedCols.begin(), nonfixedCols.end(),
+	               inserter(fixedCols, fixedCols.begin()));
+
+	// draw the random models: uniform degrees and powers for the FPs, and each UC group with probability 1/2
+	const int nModels = Rf_asInteger(R_nModels);
+	vector<modelPar> models;
+	RngStream rng = getRngStream(false);
+	for(int k = 0; k != nModels; k++){
+		modelPar mod(currentFpInfo.nFps, 0, 0);
+		mod.fpPars = PowersVector(currentFpInfo.nFps);
+		for(PosInt i = 0; i != currentFpInfo.nFps; i++){
+			const int deg = discreteUniform(0, currentFpInfo.fpmaxs[i] + 1, rng);
+			for(int j = 0; j != deg; j++)
+				mod.fpPars[i].insert(discreteUniform(0, currentFpInfo.fpcards[i], rng));
+			mod.fpSize += deg;
+		}
+		for(int g = 1; g <= nUcGroups; g++){
+			if(rng.unif() < 0.5){
+				mod.ucPars.insert(g);
+				mod.ucSize++;
+			}
+		}
+		models.push_back(mod);
+	}
+
+	// the design matrices and getR2, each timed per call
+	DoubleVector R2s;
+	IntVector dims;
+	double designSeconds = 0.0;
+	double R2Seconds = 0.0;
+	for(vector<modelPar>::const_iterator m = models.begin(); m != models.end(); ++m){
+		R_CheckUserInterrupt();
+
+		Clock::time_point start = Clock::now();
+		const AMatrix design = getDesignMatrix(*m, data, currentFpInfo, ucTermList, nUcGroups, fixedCols);
+		Clock::time_point end = Clock::now();
+		designSeconds += std::chrono::duration<double>(end - start).count();
+
+		R2s.push_back(getR2(design, data, fixedCols, hyp));
+		dims.push_back(design.n_cols);
+		R2Seconds += std::chrono::duration<double>(Clock::now() - end).count();
+	}
+
+	// the incremental R2 along the same models
+	IncrementalR2 incremental(data, currentFpInfo, ucTermList);
+	Clock::time_point start = Clock::now();
+	for(vector<modelPar>::const_iterator m = models.begin(); m != models.end(); ++m){
+		int dim;
+		incremental.R2(*m, hyp, dim);
+	}
+	const double incrementalSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	// the log marginal likelihoods of the valid models
+	HypergEngine hyperg(data.nObs, hyp.a);
+	double nValid = 0.0;
+	start = Clock::now();
+	for(DoubleVector::size_type k = 0; k != R2s.size(); k++){
+		if(! R_IsNaN(R2s[k])){
+			getVarLogMargLik(R2s[k], dims[k], hyperg);
+			nValid++;
+		}
+	}
+	const double margLikSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	// pack results
+	const StringVector kernels = {"getDesignMatrix", "getR2", "IncrementalR2", "getVarLogMargLik"};
+	const DoubleVector calls = {double(nModels), double(nModels), double(nModels), nValid};
+	const DoubleVector seconds = {designSeconds, R2Seconds, incrementalSeconds, margLikSeconds};
+
+	return Rcpp::List::create(Rcpp::_["kernel"] = kernels,
+	                          Rcpp::_["calls"] = calls,
+	                          Rcpp::_["seconds"] = seconds);
+	END_RCPP
 }
 
 // ################################################################################################
@@ -1352,4 +1886,4 @@ int main() {} // dummy
 
 
 // attention, when building shared library with R CMD SHLIB enter ALL source files that are entangled with
-// this, too!! (RnewMat.cpp e.g.)
+// this, too!! (design.cpp e.g.)
@@ -0,0 +1,560 @@
+/*
+ * bmaSamples.cpp
+ *
+ *  Engine for BmaSamples: Monte Carlo model averaging over the Gaussian hyper-g models
+ *  found by the model search. The random variates are drawn model by model from
+ *  independent substreams. With the legacy stream they are drawn in exactly the order
+ *  of the former R implementation, so that the results are reproducible with the same seed.
+ *  All deterministic work (design matrices, Cholesky roots, OLS estimates, fits, FP curves
+ *  and predictions) is then done in parallel over the models, writing directly into the
+ *  preallocated return matrices.
+ */
+
+#include "rcppExport.h"
+#include "dataStructure.h"
+#include "design.h"
+#include "linalgInterface.h"
+#include "conversions.h"
+#include "mytypes.h"
+#include "rngStreams.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+using std::vector;
+using std::set;
+
+
+// all information for sampling from one model
+struct bmaModel
+{
+    modelPar par;           // the model in the C++ format
+    PosInt dim;             // number of design matrix columns including the intercept
+    double R2;              // coefficient of determination
+    double postExpectedShrinkage; // for the fitted values
+
+    int freq;               // number of samples from this model
+    int sampleOffset;       // index of its first sample
+    vector<int> fpOffsets;  // first rows in the FP curve sample matrices
+    vector<int> ucOffsets;  // first rows in the UC coefficient sample matrices
+
+    AVector shrinkage;      // shrinkage factor samples
+    AVector bStar;          // corresponding posterior scale parameters
+    AMatrix coefs;          // t variates, transformed in place to the coefficient samples
+};
+
+
+// uncentered FP transforms of the column vector vec, see getFpTransforms in R
+static AMatrix
+getRawFpTransforms(const AVector& vec,
+                   const DoubleVector& powers)
+{
+    AMatrix ret(vec.n_elem, powers.size());
+    const AVector logVec = arma::log(vec);
+
+    AVector lastCol;
+    for (DoubleVector::size_type i = 0; i != powers.size(); ++i)
+    {
+        if ((i > 0) && (powers[i] == powers[i - 1])) // repeated powers case
+            lastCol %= logVec;
+        else if (powers[i] != 0)
+            lastCol = arma::pow(vec, powers[i]);
+        else
+            lastCol = logVec;
+
+        ret.col(i) = lastCol;
+    }
+
+    return ret;
+}
+
+
+// convert the R list of one model into the C++ model parameter
+static modelPar
+getModelPar(SEXP R_model,
+            const fpInfo& currFp,
+            const int& nUcGroups)
+{
+    modelPar ret(currFp.nFps, 0, 0);
+    ret.fpPars = PowersVector(currFp.nFps);
+
+    SEXP R_powers = getListElement(R_model, "powers");
+    for (PosInt i = 0; i != currFp.nFps; i++)
+    {
+        const DoubleVector powers = Rcpp::as<DoubleVector>(VECTOR_ELT(R_powers, i));
+        if (static_cast<int>(powers.size()) > currFp.fpmaxs[i])
+            Rcpp::stop("bmaSamples: model has more FP powers than the maximum degree allows");
+
+        for (DoubleVector::const_iterator p = powers.begin(); p != powers.end(); ++p)
+        {
+            const int index = std::find(currFp.powerset.begin(), currFp.powerset.end(), *p) - currFp.powerset.begin();
+            if (index >= currFp.fpcards[i])
+                Rcpp::stop("bmaSamples: FP power %f is not in the power set", *p);
+            ret.fpPars.at(i).insert(index);
+        }
+        ret.fpSize += powers.size();
+    }
+
+    const IntVector ucTerms = Rcpp::as<IntVector>(getListElement(R_model, "ucTerms"));
+    for (IntVector::const_iterator g = ucTerms.begin(); g != ucTerms.end(); ++g)
+    {
+        const int group = *g;
+        if ((group < 1) || (group > nUcGroups))
+            Rcpp::stop("bmaSamples: invalid uncertain fixed form covariate group %d", group);
+        ret.ucPars.insert(group);
+    }
+    ret.ucSize = ret.ucPars.size();
+
+    return ret;
+}
+
+
+SEXP
+bmaSamples(SEXP R_x, // (not centered!) design matrix
+           SEXP R_xcentered, // centered design matrix
+           SEXP R_y, // response vector
+           SEXP R_fpmaxs, // vector of maximum fp degrees
+           SEXP R_fppos, // corresponding vector of fp column indices
+           SEXP R_fpcards, // corresponding vector of power set cardinalities
+           SEXP R_nFps, // number of fp terms
+           SEXP R_fpnames, // names of fp terms
+           SEXP R_ucIndices, // vector giving uncertainty custer indices (column -> which group)
+           SEXP R_ucTermList, // list for group -> which columns mapping
+           SEXP R_nUcGroups, // number of uncertainty groups
+           SEXP R_hyperparam, // hyperparameter a for hyper-g prior
+           SEXP R_models, // list of the models (elements of the BayesMfp object)
+           SEXP R_freqs, // number of samples from each model
+           SEXP R_grids, // list of scaled grids for the FP curves (or NULL if not needed)
+           SEXP R_newX, // covariates matrix for new data (or NULL)
+           SEXP R_includeZeroSamples, // include zero samples for not included covariates?
+           SEXP R_legacyRng) // use R's random number generator directly?
+{
+    BEGIN_RCPP
+    // unpack ###
+    // data (views of the R memory, nothing is copied)
+    const AMatrix x = shareMatrix(R_x);
+    const AMatrix xcentered = shareMatrix(R_xcentered);
+    const AVector y = shareVector(R_y);
+    const dataValues data(x, xcentered, y, 0);
+
+    const double nObs = data.nObs;
+    const double yMean = arma::mean(y);
+    const double aStar = (nObs - 1.0) / 2.0;
+    const double alpha = Rf_asReal(R_hyperparam);
+
+    // fp info
+    const fpInfo currentFpInfo(R_nFps, R_fpcards, R_fppos, R_fpmaxs, R_fpnames, x);
+    const PosInt nFps = currentFpInfo.nFps;
+
+    // uc info
+    const int nUcGroups = INTEGER(R_nUcGroups)[0];
+    vector<IntSet> ucTermList(nUcGroups);
+    for (int i = 0; i != nUcGroups; i++)
+    {
+        SEXP temp = VECTOR_ELT(R_ucTermList, i);
+        std::copy(INTEGER(temp), INTEGER(temp) + Rf_length(temp),
+                  std::inserter(ucTermList.at(i), ucTermList.at(i).begin()));
+    }
+
+    // only the intercept is fixed
+    set<int> fixedCols;
+    for (R_len_t i = 0; i != Rf_length(R_ucIndices); i++)
+    {
+        if ((INTEGER(R_ucIndices)[i] == 0) &&
+            (std::find(currentFpInfo.fppos, currentFpInfo.fppos + nFps, i + 1) == currentFpInfo.fppos + nFps))
+            fixedCols.insert(i + 1);
+    }
+
+    // the grids
+    vector<AVector> grids(nFps);
+    for (PosInt i = 0; i != nFps; i++)
+    {
+        SEXP thisGrid = VECTOR_ELT(R_grids, i);
+        if (! Rf_isNull(thisGrid))
+            grids.at(i) = vec2col(thisGrid);
+    }
+
+    // new data?
+    const bool doPredict = ! Rf_isNull(R_newX);
+    const AMatrix newX = doPredict ? shareMatrix(R_newX) : AMatrix();
+    const int nNewObs = newX.n_rows;
+
+    const bool includeZeroSamples = LOGICAL(R_includeZeroSamples)[0];
+    const bool legacyRng = LOGICAL(R_legacyRng)[0];
+
+    // setup the models and their places in the return matrices ###
+    const int nModels = Rf_length(R_models);
+    vector<bmaModel> models(nModels);
+
+    int sampleSize = 0;
+    vector<int> fpSampleSizes(nFps, 0);
+    vector<int> ucSampleSizes(nUcGroups, 0);
+
+    for (int j = 0; j != nModels; j++)
+    {
+        bmaModel& thisModel = models.at(j);
+        SEXP R_model = VECTOR_ELT(R_models, j);
+
+        thisModel.par = getModelPar(R_model, currentFpInfo, nUcGroups);
+        thisModel.dim = 1 + thisModel.par.fpSize;
+        for (set<int>::const_iterator g = thisModel.par.ucPars.begin(); g != thisModel.par.ucPars.end(); ++g)
+            thisModel.dim += ucTermList.at(*g - 1).size();
+
+        thisModel.R2 = Rf_asReal(getListElement(R_model, "R2"));
+        thisModel.postExpectedShrinkage = Rf_asReal(getListElement(R_model, "postExpectedShrinkage"));
+
+        thisModel.freq = INTEGER(R_freqs)[j];
+        thisModel.sampleOffset = sampleSize;
+        sampleSize += thisModel.freq;
+
+        thisModel.fpOffsets.resize(nFps);
+        for (PosInt i = 0; i != nFps; i++)
+        {
+            thisModel.fpOffsets[i] = fpSampleSizes[i];
+            if (thisModel.freq && (includeZeroSamples || ! thisModel.par.fpPars[i].empty()))
+            {
+                if (grids.at(i).is_empty())
+                    Rcpp::stop("bmaSamples: grid for FP number %d is missing", i + 1);
+                fpSampleSizes[i] += thisModel.freq;
+            }
+        }
+
+        thisModel.ucOffsets.resize(nUcGroups);
+        for (int g = 0; g != nUcGroups; g++)
+        {
+            thisModel.ucOffsets[g] = ucSampleSizes[g];
+            if (thisModel.freq && (includeZeroSamples || thisModel.par.ucPars.count(g + 1)))
+                ucSampleSizes[g] += thisModel.freq;
+        }
+    }
+
+    // allocate the return matrices ###
+    PosInt nProtect = 0;
+
+    SEXP R_fitted;
+    Rf_protect(R_fitted = Rf_allocMatrix(REALSXP, nModels, data.nObs));
+    ++nProtect;
+
+    SEXP R_shrinkage, R_sigma2, R_intercept;
+    Rf_protect(R_shrinkage = Rf_allocVector(REALSXP, sampleSize));
+    Rf_protect(R_sigma2 = Rf_allocVector(REALSXP, sampleSize));
+    Rf_protect(R_intercept = Rf_allocVector(REALSXP, sampleSize));
+    nProtect += 3;
+
+    SEXP R_bfp;
+    Rf_protect(R_bfp = Rf_allocVector(VECSXP, nFps));
+    ++nProtect;
+    vector<double*> bfpSamples(nFps, static_cast<double*>(0));
+    for (PosInt i = 0; i != nFps; i++)
+    {
+        if (fpSampleSizes[i] > 0)
+        {
+            SET_VECTOR_ELT(R_bfp, i, Rf_allocMatrix(REALSXP, fpSampleSizes[i], grids.at(i).n_elem));
+            bfpSamples[i] = REAL(VECTOR_ELT(R_bfp, i));
+        }
+    }
+
+    SEXP R_uc;
+    Rf_protect(R_uc = Rf_allocVector(VECSXP, nUcGroups));
+    ++nProtect;
+    vector<double*> ucSamples(nUcGroups, static_cast<double*>(0));
+    for (int g = 0; g != nUcGroups; g++)
+    {
+        if (ucSampleSizes[g] > 0)
+        {
+            SET_VECTOR_ELT(R_uc, g, Rf_allocMatrix(REALSXP, ucSampleSizes[g], ucTermList.at(g).size()));
+            ucSamples[g] = REAL(VECTOR_ELT(R_uc, g));
+        }
+    }
+
+    SEXP R_predictMeans = R_NilValue;
+    if (doPredict)
+    {
+        Rf_protect(R_predictMeans = Rf_allocMatrix(REALSXP, nNewObs, sampleSize));
+        ++nProtect;
+    }
+
+    double* fitted = REAL(R_fitted);
+    double* shrinkage = REAL(R_shrinkage);
+    double* sigma2 = REAL(R_sigma2);
+    double* intercept = REAL(R_intercept);
+    double* predictMeans = doPredict ? REAL(R_predictMeans) : static_cast<double*>(0);
+
+    // draw all random variates, from one substream per model ###
+    // (the legacy stream gives the order of the former R implementation)
+    const RngStream rng = getRngStream(legacyRng);
+    GetRNGstate();
+    for (int j = 0; j != nModels; j++)
+    {
+        bmaModel& thisModel = models.at(j);
+        const int m = thisModel.freq;
+        if (m == 0)
+            continue;
+
+        RngStream modelRng = rng.split(j);
+
+        // shrinkage factors by inversion, cf. rshrinkage in R
+        thisModel.shrinkage.set_size(m);
+        if (thisModel.dim > 1)
+        {
+            const double shape1 = (nObs - thisModel.dim - alpha + 1.0) / 2.0;
+            const double shape2 = (thisModel.dim + alpha - 2.0) / 2.0;
+            const double oneMinusR2 = 1.0 - thisModel.R2;
+            const double lowerProb = R::pbeta(oneMinusR2, shape1, shape2, 1, 0);
+
+            for (int s = 0; s != m; s++)
+            {
+                const double u = modelRng.unif();
+                const double innerFraction = oneMinusR2 / R::qbeta(u + (1.0 - u) * lowerProb, shape1, shape2, 1, 0);
+                thisModel.shrinkage[s] = (1.0 - innerFraction) / thisModel.R2;
+            }
+        }
+        else
+        {
+            // null model: no shrinkage
+            thisModel.shrinkage.fill(1.0);
+        }
+        std::copy(thisModel.shrinkage.begin(), thisModel.shrinkage.end(), shrinkage + thisModel.sampleOffset);
+
+        thisModel.bStar = (1.0 - thisModel.shrinkage * thisModel.R2) * data.sumOfSquaresTotal / 2.0;
+
+        // regression variances
+        for (int s = 0; s != m; s++)
+            sigma2[thisModel.sampleOffset + s] = 1.0 / modelRng.gamma(aStar, 1.0 / thisModel.bStar[s]);
+
+        // intercepts
+        for (int s = 0; s != m; s++)
+            intercept[thisModel.sampleOffset + s] = yMean + sqrt(thisModel.bStar[s] / aStar / nObs) * modelRng.studentT(nObs - 1.0);
+
+        // t variates for the effects
+        thisModel.coefs.set_size(thisModel.dim - 1, m);
+        for (arma::uword k = 0; k != thisModel.coefs.n_elem; k++)
+            thisModel.coefs[k] = modelRng.studentT(nObs - 1.0);
+    }
+    PutRNGstate();
+
+    // now the deterministic part, in parallel over the models ###
+    int nFailed = 0;
+    std::string error;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+:nFailed)
+#endif
+    for (int j = 0; j < nModels; j++)
+    {
+        // (exceptions must not leave the parallel region, so the first one is raised after it)
+        try
+        {
+            bmaModel& thisModel = models.at(j);
+            const int m = thisModel.freq;
+            const PosInt nEffects = thisModel.dim - 1;
+
+            const AMatrix design = getDesignMatrix(thisModel.par, data, currentFpInfo, ucTermList, nUcGroups, fixedCols);
+
+            // OLS estimates and the left Cholesky root of XtX
+            AVector betaOLS;
+            AMatrix XtX;
+            // (the non-intercept columns are contiguous in memory, so no copy is needed)
+            const AMatrix X(const_cast<double*>(design.memptr()) + design.n_rows, design.n_rows, nEffects, false, true);
+            if (nEffects > 0)
+            {
+                XtX.set_size(nEffects, nEffects);
+                syrk(false, true, X, 0.0, XtX);
+                if (potrf(false, XtX) != 0)
+                {
+                    // this model cannot be used: mark all its results as missing
+                    ++nFailed;
+
+                    for (int k = 0; k != data.nObs; k++)
+                        fitted[j + k * nModels] = NA_REAL;
+
+                    for (int s = 0; s != m; s++)
+                    {
+                        shrinkage[thisModel.sampleOffset + s] = NA_REAL;
+                        sigma2[thisModel.sampleOffset + s] = NA_REAL;
+                        intercept[thisModel.sampleOffset + s] = NA_REAL;
+                    }
+
+                    for (PosInt i = 0; i != nFps; i++)
+                    {
+                        if ((m > 0) && (includeZeroSamples || ! thisModel.par.fpPars[i].empty()))
+                        {
+                            const int nGrid = grids.at(i).n_elem;
+                            const int nRows = fpSampleSizes[i];
+                            for (int s = 0; s != m; s++)
+                                for (int k = 0; k != nGrid; k++)
+                                    bfpSamples[i][thisModel.fpOffsets[i] + s + k * nRows] = NA_REAL;
+                        }
+                    }
+
+                    for (int g = 0; g != nUcGroups; g++)
+                    {
+                        if ((m > 0) && (includeZeroSamples || thisModel.par.ucPars.count(g + 1)))
+                        {
+                            const int p = ucTermList.at(g).size();
+                            const int nRows = ucSampleSizes[g];
+                            for (int s = 0; s != m; s++)
+                                for (int c = 0; c != p; c++)
+                                    ucSamples[g][thisModel.ucOffsets[g] + s + c * nRows] = NA_REAL;
+                        }
+                    }
+
+                    if (doPredict)
+                        std::fill(predictMeans + thisModel.sampleOffset * nNewObs,
+                                  predictMeans + (thisModel.sampleOffset + m) * nNewObs,
+                                  NA_REAL);
+
+                    continue;
+                }
+
+                AMatrix tmp = X.t() * y;
+                trs(false, false, XtX, tmp);
+                trs(false, true, XtX, tmp);
+                betaOLS = tmp.col(0);
+            }
+
+            // fitted values with the posterior expected shrinkage factor
+            AVector thisFit(data.nObs);
+            thisFit.fill(yMean);
+            if (nEffects > 0)
+                thisFit += X * (thisModel.postExpectedShrinkage * betaOLS);
+            for (int k = 0; k != data.nObs; k++)
+                fitted[j + k * nModels] = thisFit[k];
+
+            if (m == 0)
+                continue;
+
+            // the coefficient samples
+            AMatrix& coefs = thisModel.coefs;
+            if (nEffects > 0)
+            {
+                trs(false, true, XtX, coefs);
+                for (int s = 0; s != m; s++)
+                {
+                    coefs.col(s) = thisModel.shrinkage[s] * betaOLS +
+                        sqrt(thisModel.shrinkage[s] * thisModel.bStar[s] / aStar) * coefs.col(s);
+                }
+            }
+
+            // FP curves at the grids, and the new design matrix for predictions
+            AMatrix newDesign;
+            if (doPredict)
+                newDesign.set_size(nNewObs, nEffects);
+
+            PosInt rowCounter = 0;
+            for (PosInt i = 0; i != nFps; i++)
+            {
+                const Powers& powersi = thisModel.par.fpPars[i];
+                const PosInt len = powersi.size();
+                const int nGrid = grids.at(i).n_elem;
+                const int nRows = fpSampleSizes[i];
+
+                if (len > 0)
+                {
+                    const DoubleVector powers = currentFpInfo.inds2powers(powersi);
+
+                    AMatrix gridMat = getRawFpTransforms(grids.at(i), powers);
+                    gridMat.each_row() -= arma::mean(gridMat, 0);
+                    const AMatrix means = gridMat * coefs.rows(rowCounter, rowCounter + len - 1);
+
+                    for (int s = 0; s != m; s++)
+                        for (int k = 0; k != nGrid; k++)
+                            bfpSamples[i][thisModel.fpOffsets[i] + s + k * nRows] = means(k, s);
+
+                    if (doPredict)
+                    {
+                        // use the shifts of the original design matrix
+                        AMatrix newCols = getRawFpTransforms(newX.col(currentFpInfo.fppos[i] - 1), powers);
+                        newCols.each_row() -= arma::mean(getRawFpTransforms(x.col(currentFpInfo.fppos[i] - 1), powers), 0);
+                        newDesign.cols(rowCounter, rowCounter + len - 1) = newCols;
+                    }
+
+                    rowCounter += len;
+                }
+                else if (includeZeroSamples)
+                {
+                    for (int s = 0; s != m; s++)
+                        for (int k = 0; k != nGrid; k++)
+                            bfpSamples[i][thisModel.fpOffsets[i] + s + k * nRows] = 0.0;
+                }
+            }
+
+            // UC coefficients
+            for (int g = 0; g != nUcGroups; g++)
+            {
+                const IntSet& thisColList = ucTermList.at(g);
+                const int p = thisColList.size();
+                const int nRows = ucSampleSizes[g];
+                const bool included = thisModel.par.ucPars.count(g + 1);
+
+                if (included || includeZeroSamples)
+                {
+                    for (int s = 0; s != m; s++)
+                        for (int c = 0; c != p; c++)
+                            ucSamples[g][thisModel.ucOffsets[g] + s + c * nRows] = included ? coefs(rowCounter + c, s) : 0.0;
+                }
+
+                if (included)
+                {
+                    if (doPredict)
+                    {
+                        int c = rowCounter;
+                        for (IntSet::const_iterator col = thisColList.begin(); col != thisColList.end(); ++col, ++c)
+                            newDesign.col(c) = newX.col(*col - 1) - arma::mean(x.col(*col - 1));
+                    }
+                    rowCounter += p;
+                }
+            }
+
+            // predictive means for the new data
+            if (doPredict)
+            {
+                for (int s = 0; s != m; s++)
+                {
+                    AVector thisMean(nNewObs);
+                    thisMean.fill(intercept[thisModel.sampleOffset + s]);
+                    if (nEffects > 0)
+                        thisMean += newDesign * coefs.col(s);
+
+                    std::copy(thisMean.begin(), thisMean.end(), predictMeans + (thisModel.sampleOffset + s) * nNewObs);
+                }
+            }
+        }
+        catch (std::exception& e)
+        {
+#ifdef _OPENMP
+#pragma omp critical(bmaSamplesError)
+#endif
+            {
+                if (error.empty())
+                    error = e.what();
+            }
+        }
+    }
+
+    if (! error.empty())
+        Rcpp::stop(error);
+
+    if (nFailed > 0)
+        Rf_warning("bmaSamples: %d models had a non positive definite cross product matrix, their samples are NA", nFailed);
+
+    // pack results into R list
+    Rcpp::List ret = Rcpp::List::create(Rcpp::_["fitted"] = R_fitted,
+                                        Rcpp::_["shrinkage"] = R_shrinkage,
+                                        Rcpp::_["sigma2"] = R_sigma2,
+                                        Rcpp::_["intercept"] = R_intercept,
+                                        Rcpp::_["bfp"] = R_bfp,
+                                        Rcpp::_["uc"] = R_uc,
+                                        Rcpp::_["predictMeans"] = R_predictMeans);
+
+    Rf_unprotect(nProtect);
+    return ret;
+    END_RCPP
+}
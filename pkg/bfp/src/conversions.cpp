@@ -152,7 +152,7 @@ getDoubleElement(SEXP R_realVector, const std::string &name)
 
 
 
-ReturnMatrix getMatrix(const SEXP& m) // R-Matrix to Newmat-Matrix
+AMatrix getMatrix(const SEXP& m) // R-Matrix to Armadillo matrix
 {
         unsigned int mx, my;
         int *mDim;
@@ -164,43 +164,43 @@ ReturnMatrix getMatrix(const SEXP& m) // R-Matrix to Newmat-Matrix
         mx = mDim[0];
         my = mDim[1];
 
-        Matrix M(my, mx); // copy array into matrix. This is done rowwise, so transpose necessary
-        M << a;
-        M = M.t();
-
-        M.Release(); return M;
+        // both R and Armadillo use column-major storage, so simply copy the array
+        return AMatrix(a, mx, my);
 }
 
-ColumnVector vec2col(const SEXP& v) // R-Vector to Newmat-column vector
+AVector vec2col(const SEXP& v) // R-Vector to Armadillo column vector
 {
         if (Rf_isMatrix(v))
                 Rcpp::stop("Argument of vec2col is a matrix\n");
 
-        ColumnVector V(Rf_length(v));
-        double *a = REAL(v);
-        V << a;
+        return AVector(REAL(v), Rf_length(v));
+}
+
+AMatrix shareMatrix(const SEXP& m) // R-Matrix to Armadillo matrix view
+{
+        const int *mDim = INTEGER(Rf_getAttrib(m, R_DimSymbol));
 
-        return V;
+        return AMatrix(REAL(m), mDim[0], mDim[1], false, true);
 }
 
-SEXP putMatrix(const Matrix& M) // Newmat-Matrix to R-Matrix
+AVector shareVector(const SEXP& v) // R-Vector to Armadillo column vector view
 {
-        unsigned int nProtected = 0, Mx, My, i, j;
-        double *a;
-        SEXP ret;
+        if (Rf_isMatrix(v))
+                Rcpp::stop("Argument of shareVector is a matrix\n");
+
+        return AVector(REAL(v), Rf_length(v), false, true);
+}
 
-        Mx = M.Nrows(); // get dimensions of M
-        My = M.Ncols();
+SEXP putMatrix(const AMatrix& M) // Armadillo matrix to R-Matrix
+{
+        unsigned int nProtected = 0;
+        SEXP ret;
 
-        Rf_protect(ret = Rf_allocMatrix(REALSXP, Mx, My)); // allocate return matrix
+        Rf_protect(ret = Rf_allocMatrix(REALSXP, M.n_rows, M.n_cols)); // allocate return matrix
         ++nProtected;
-        a = REAL(ret);
 
-        for (i = 0; i != Mx; i++){      // put values in return matrix
-                for (j = 0; j != My; j++){
-                        a[i + j * Mx] = M.element(i,j);
-                }
-        }
+        // column-major storage in both cases
+        std::copy(M.begin(), M.end(), REAL(ret));
 
         Rf_unprotect(nProtected); // unprotect everything
         return ret;
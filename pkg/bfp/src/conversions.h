@@ -76,17 +76,27 @@ getListElement(SEXP R_list, const std::string &name);
 double
 getDoubleElement(SEXP R_realVector, const std::string &name);
 
-// R-Matrix to Newmat-Matrix
-ReturnMatrix
+// R-Matrix to Armadillo matrix
+AMatrix
 getMatrix(const SEXP&);
 
-// R-Vector to Newmat-column vector
-ColumnVector
+// R-Vector to Armadillo column vector
+AVector
 vec2col(const SEXP&);
 
-// Newmat-Matrix to R-Matrix
+// R-Matrix to Armadillo matrix, but without copying:
+// the result is a view of the R memory, so the R object must
+// stay protected as long as the view is used
+AMatrix
+shareMatrix(const SEXP&);
+
+// same for R-Vector to Armadillo column vector
+AVector
+shareVector(const SEXP&);
+
+// Armadillo matrix to R-Matrix
 SEXP
-putMatrix(const Matrix&);
+putMatrix(const AMatrix&);
 
 // convert frequency vector into multiset
 Powers
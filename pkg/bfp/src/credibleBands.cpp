@@ -0,0 +1,465 @@
+/*
+ * credibleBands.cpp
+ */
+
+#include "credibleBands.h"
+#include "conversions.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <cmath>
+
+// ***************************************************************************************************//
+
+SampleMatrix::SampleMatrix(const double* x,
+                           R_xlen_t nrow,
+                           R_xlen_t ncol,
+                           bool samplesInRows) :
+    columns(samplesInRows ? ncol : nrow),
+    n(samplesInRows ? nrow : ncol),
+    stride(samplesInRows ? 1 : nrow)
+{
+    for (R_xlen_t par = 0; par != nPars(); ++par)
+        columns[par] = x + (samplesInRows ? par * nrow : par);
+}
+
+SampleMatrix::SampleMatrix(const std::vector<const double*>& columns,
+                           R_xlen_t nSamples) :
+    columns(columns),
+    n(nSamples),
+    stride(1)
+{
+}
+
+bool
+SampleMatrix::allFinite() const
+{
+    for (R_xlen_t par = 0; par != nPars(); ++par)
+        for (R_xlen_t i = 0; i != n; ++i)
+            if (! R_FINITE(at(i, par)))
+                return false;
+
+    return true;
+}
+
+// ***************************************************************************************************//
+
+// the samples of one parameter, copied into a buffer of the calling thread
+static void
+copyColumn(const SampleMatrix& samples,
+           R_xlen_t par,
+           DoubleVector& buffer)
+{
+    buffer.resize(samples.nSamples());
+    for (R_xlen_t i = 0; i != samples.nSamples(); ++i)
+        buffer[i] = samples.at(i, par);
+}
+
+// Rank the samples of each parameter (or their absolute distances to the center,
+// if given) with averaged ties, as R's rank does, and collect the minimum and maximum
+// rank of each sample over all parameters. The parameters are ranked in parallel,
+// each thread keeping its own row extremes, which are merged at the end.
+static void
+rowRankExtremes(const SampleMatrix& samples,
+                const double* center,
+                DoubleVector& rowMin,
+                DoubleVector& rowMax)
+{
+    const R_xlen_t n = samples.nSamples();
+    const int nPars = samples.nPars();
+
+    rowMin.assign(n, std::numeric_limits<double>::infinity());
+    rowMax.assign(n, - std::numeric_limits<double>::infinity());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        DoubleVector myMin(n, std::numeric_limits<double>::infinity());
+        DoubleVector myMax(n, - std::numeric_limits<double>::infinity());
+        std::vector<std::pair<double, R_xlen_t> > order(n);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int par = 0; par < nPars; par++)
+        {
+            for (R_xlen_t i = 0; i != n; ++i)
+            {
+                const double x = samples.at(i, par);
+                order[i] = std::make_pair(center ? std::fabs(x - center[par]) : x, i);
+            }
+            std::sort(order.begin(), order.end());
+
+            // walk through the runs of ties
+            for (R_xlen_t start = 0; start != n; )
+            {
+                R_xlen_t end = start + 1;
+                while ((end != n) && (order[end].first == order[start].first))
+                    ++end;
+
+                const double rank = (start + 1 + end) / 2.0;
+                for (R_xlen_t pos = start; pos != end; ++pos)
+                {
+                    const R_xlen_t i = order[pos].second;
+                    myMin[i] = std::min(myMin[i], rank);
+                    myMax[i] = std::max(myMax[i], rank);
+                }
+
+                start = end;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        for (R_xlen_t i = 0; i != n; ++i)
+        {
+            rowMin[i] = std::min(rowMin[i], myMin[i]);
+            rowMax[i] = std::max(rowMax[i], myMax[i]);
+        }
+    }
+}
+
+// the k-th smallest value (k starting from 1) of values, by selection
+static double
+kthSmallest(DoubleVector values,
+            R_xlen_t k)
+{
+    k = std::max(std::min(k, static_cast<R_xlen_t>(values.size())), static_cast<R_xlen_t>(1));
+    std::nth_element(values.begin(), values.begin() + (k - 1), values.end());
+    return values[k - 1];
+}
+
+// ***************************************************************************************************//
+
+DoubleVector
+empiricalHpds(const SampleMatrix& samples,
+              double level)
+{
+    const R_xlen_t n = samples.nSamples();
+    const int nPars = samples.nPars();
+
+    // the number of candidate intervals, each containing n - nIntervals + 1 samples
+    const R_xlen_t nIntervals = static_cast<R_xlen_t>(std::ceil(n * (1.0 - level)));
+
+    DoubleVector ret(2 * nPars);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        DoubleVector sorted;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int par = 0; par < nPars; par++)
+        {
+            copyColumn(samples, par, sorted);
+
+            // only the nIntervals smallest and largest samples are needed in sorted order
+            if (2 * nIntervals <= n)
+            {
+                std::nth_element(sorted.begin(), sorted.begin() + (nIntervals - 1), sorted.end());
+                std::sort(sorted.begin(), sorted.begin() + nIntervals);
+
+                std::nth_element(sorted.begin() + nIntervals, sorted.begin() + (n - nIntervals), sorted.end());
+                std::sort(sorted.begin() + (n - nIntervals), sorted.end());
+            }
+            else
+            {
+                std::sort(sorted.begin(), sorted.end());
+            }
+
+            // the first interval with the smallest range
+            R_xlen_t smallest = 0;
+            for (R_xlen_t start = 1; start < nIntervals; ++start)
+            {
+                if (sorted[n - nIntervals + start] - sorted[start] <
+                    sorted[n - nIntervals + smallest] - sorted[smallest])
+                    smallest = start;
+            }
+
+            ret[2 * par] = sorted[smallest];
+            ret[2 * par + 1] = sorted[n - nIntervals + smallest];
+        }
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+DoubleVector
+scrHpdBand(const SampleMatrix& samples,
+           const DoubleVector& mode,
+           double level)
+{
+    const R_xlen_t n = samples.nSamples();
+    const int nPars = samples.nPars();
+
+    // the maximum distance ranks of the samples
+    DoubleVector rowMin, rowMax;
+    rowRankExtremes(samples, mode.data(), rowMin, rowMax);
+
+    // the rank which divides the samples in contained and rejected samples
+    const double tstar = kthSmallest(rowMax, static_cast<R_xlen_t>(std::floor(level * n)));
+
+    // the parameterwise ranges of the contained samples form the SCB.
+    // Because of ties, possibly more than the required number of samples are contained.
+    DoubleVector ret(2 * nPars);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int par = 0; par < nPars; par++)
+    {
+        double lower = std::numeric_limits<double>::infinity();
+        double upper = - std::numeric_limits<double>::infinity();
+
+        for (R_xlen_t i = 0; i != n; ++i)
+        {
+            if (rowMax[i] <= tstar)
+            {
+                const double x = samples.at(i, par);
+                lower = std::min(lower, x);
+                upper = std::max(upper, x);
+            }
+        }
+
+        ret[2 * par] = lower;
+        ret[2 * par + 1] = upper;
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+DoubleVector
+scrBesagBand(const SampleMatrix& samples,
+             double level)
+{
+    const R_xlen_t n = samples.nSamples();
+    const int nPars = samples.nPars();
+
+    DoubleVector rowMin, rowMax;
+    rowRankExtremes(samples, 0, rowMin, rowMax);
+
+    // the extreme rank of each sample, whichever tail it is in
+    DoubleVector extremeRanks(n);
+    for (R_xlen_t i = 0; i != n; ++i)
+        extremeRanks[i] = std::max(n + 1 - rowMin[i], rowMax[i]);
+
+    const double tstar = kthSmallest(extremeRanks, static_cast<R_xlen_t>(std::floor(level * n)) + 1);
+
+    // the order statistics forming the band (truncated as R's indexing does),
+    // where always lowerIndex <= upperIndex because tstar >= (n + 1) / 2
+    const R_xlen_t lowerIndex = static_cast<R_xlen_t>(n + 1 - tstar) - 1;
+    const R_xlen_t upperIndex = static_cast<R_xlen_t>(tstar) - 1;
+
+    DoubleVector ret(2 * nPars);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        DoubleVector column;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int par = 0; par < nPars; par++)
+        {
+            copyColumn(samples, par, column);
+
+            std::nth_element(column.begin(), column.begin() + lowerIndex, column.end());
+            ret[2 * par] = column[lowerIndex];
+
+            std::nth_element(column.begin() + lowerIndex, column.begin() + upperIndex, column.end());
+            ret[2 * par + 1] = column[upperIndex];
+        }
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+BandStream::BandStream(PosInt nPars,
+                       const DoubleVector& mode) :
+    mode(mode),
+    columns(nPars)
+{
+}
+
+void
+BandStream::add(const double* chunk,
+                R_xlen_t nrow)
+{
+    for (PosInt par = 0; par != columns.size(); ++par)
+        columns[par].insert(columns[par].end(), chunk + par * nrow, chunk + (par + 1) * nrow);
+}
+
+DoubleVector
+BandStream::band(double level) const
+{
+    std::vector<const double*> pointers(columns.size());
+    for (PosInt par = 0; par != columns.size(); ++par)
+        pointers[par] = &columns[par].front();
+
+    const SampleMatrix samples(pointers, nSamples());
+
+    return mode.empty() ? scrBesagBand(samples, level) : scrHpdBand(samples, mode, level);
+}
+
+// ***************************************************************************************************//
+
+// the 2 x nPars R matrix from the bounds
+static SEXP
+putBounds(const DoubleVector& bounds)
+{
+    SEXP R_ret;
+    Rf_protect(R_ret = Rf_allocMatrix(REALSXP, 2, bounds.size() / 2));
+    std::copy(bounds.begin(), bounds.end(), REAL(R_ret));
+    Rf_unprotect(1);
+    return R_ret;
+}
+
+// check the samples matrix and the level, and return the view of the samples
+static SampleMatrix
+getSamples(SEXP R_samples,
+           double level)
+{
+    if (! (Rf_isMatrix(R_samples) && Rf_isReal(R_samples)))
+        Rcpp::stop("samples must be a numeric matrix");
+    if (! ((level > 0.0) && (level < 1.0)))
+        Rcpp::stop("level must be in (0, 1)");
+
+    const SampleMatrix ret(REAL(R_samples), Rf_nrows(R_samples), Rf_ncols(R_samples), true);
+
+    if (ret.nSamples() < 1)
+        Rcpp::stop("samples must not be empty");
+    if (! ret.allFinite())
+        Rcpp::stop("samples must be finite");
+
+    return ret;
+}
+
+SEXP
+pointwiseHpds(SEXP R_samples, // samples matrix, each row is a sample
+              SEXP R_level) // credible level
+{
+    BEGIN_RCPP
+    const double level = Rf_asReal(R_level);
+    return putBounds(empiricalHpds(getSamples(R_samples, level), level));
+    END_RCPP
+}
+
+SEXP
+simultaneousBand(SEXP R_samples, // samples matrix, each row is a sample
+                 SEXP R_mode, // mode vector for the HPD band, or NULL for the Besag band
+                 SEXP R_level) // credible level
+{
+    BEGIN_RCPP
+    const double level = Rf_asReal(R_level);
+    const SampleMatrix samples = getSamples(R_samples, level);
+
+    if (std::floor(level * samples.nSamples()) < 1.0)
+        Rcpp::stop("too few samples for this credible level");
+
+    if (Rf_isNull(R_mode))
+        return putBounds(scrBesagBand(samples, level));
+
+    const DoubleVector mode = getDoubleVector(R_mode);
+    if (static_cast<R_xlen_t>(mode.size()) != samples.nPars())
+        Rcpp::stop("mode vector must have same length as samples matrix!");
+
+    return putBounds(scrHpdBand(samples, mode, level));
+    END_RCPP
+}
+
+// ***************************************************************************************************//
+
+static void
+finalizeBandStream(SEXP R_stream)
+{
+    delete static_cast<BandStream*>(R_ExternalPtrAddr(R_stream));
+    R_ClearExternalPtr(R_stream);
+}
+
+static BandStream*
+getBandStream(SEXP R_stream)
+{
+    BandStream* ret = 0;
+    if (TYPEOF(R_stream) == EXTPTRSXP)
+        ret = static_cast<BandStream*>(R_ExternalPtrAddr(R_stream));
+    if (ret == 0)
+        Rcpp::stop("invalid band stream");
+    return ret;
+}
+
+SEXP
+bandStreamNew(SEXP R_nPars, // number of parameters
+              SEXP R_mode) // mode vector for the HPD band, or NULL for the Besag band
+{
+    BEGIN_RCPP
+    const DoubleVector mode = Rf_isNull(R_mode) ? DoubleVector() : getDoubleVector(R_mode);
+    const PosInt nPars = Rf_asInteger(R_nPars);
+
+    if (! (Rf_isNull(R_mode) || (mode.size() == nPars)))
+        Rcpp::stop("mode vector must have length nPars");
+
+    SEXP R_ret;
+    Rf_protect(R_ret = R_MakeExternalPtr(new BandStream(nPars, mode), R_NilValue, R_NilValue));
+    R_RegisterCFinalizerEx(R_ret, finalizeBandStream, TRUE);
+    Rf_unprotect(1);
+    return R_ret;
+    END_RCPP
+}
+
+SEXP
+bandStreamAdd(SEXP R_stream, // the band stream
+              SEXP R_chunk) // chunk of samples, each row is a sample
+{
+    BEGIN_RCPP
+    BandStream* stream = getBandStream(R_stream);
+
+    if (! (Rf_isMatrix(R_chunk) && Rf_isReal(R_chunk)))
+        Rcpp::stop("chunk must be a numeric matrix");
+
+    const SampleMatrix chunk(REAL(R_chunk), Rf_nrows(R_chunk), Rf_ncols(R_chunk), true);
+    if (chunk.nPars() != static_cast<R_xlen_t>(stream->nPars()))
+        Rcpp::stop("chunk has wrong number of columns");
+    if (! chunk.allFinite())
+        Rcpp::stop("samples must be finite");
+
+    stream->add(REAL(R_chunk), chunk.nSamples());
+    return Rf_ScalarReal(static_cast<double>(stream->nSamples()));
+    END_RCPP
+}
+
+SEXP
+bandStreamBand(SEXP R_stream, // the band stream
+               SEXP R_level) // credible level
+{
+    BEGIN_RCPP
+    const BandStream* stream = getBandStream(R_stream);
+    const double level = Rf_asReal(R_level);
+
+    if (! ((level > 0.0) && (level < 1.0)))
+        Rcpp::stop("level must be in (0, 1)");
+    if (std::floor(level * stream->nSamples()) < 1.0)
+        Rcpp::stop("too few samples for this credible level");
+
+    return putBounds(stream->band(level));
+    END_RCPP
+}
+
+// End of credibleBands.cpp
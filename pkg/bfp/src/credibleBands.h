@@ -0,0 +1,125 @@
+/*
+ * credibleBands.h
+ *
+ *  Engine for the (simultaneous) credible bands computed from curve samples:
+ *  the pointwise empirical HPD intervals, the HPD SCB around a mode vector and
+ *  the SCB of Besag et al. (1995). The parameters (grid points) are ranked in parallel,
+ *  and the row-wise extreme ranks are collected in the same pass, without ever
+ *  storing the matrix of ranks. The order statistics which are needed afterwards
+ *  are found by selection instead of full sorts.
+ */
+
+#ifndef CREDIBLEBANDS_H_
+#define CREDIBLEBANDS_H_
+
+#include "mytypes.h"
+
+#include <R.h>
+#include <Rinternals.h>
+
+#include <vector>
+
+// read-only view of the samples matrix: for each parameter, the pointer to its first sample
+// and the distance between two consecutive samples. So both the layouts "samples in rows"
+// and "samples in columns" of a column-major R matrix can be used without copies.
+class SampleMatrix
+{
+public:
+    // an R matrix with nrow x ncol elements. If samplesInRows, each row is a sample,
+    // otherwise each column.
+    SampleMatrix(const double* x,
+                 R_xlen_t nrow,
+                 R_xlen_t ncol,
+                 bool samplesInRows);
+
+    // separately stored columns of nSamples samples each, one column for each parameter
+    SampleMatrix(const std::vector<const double*>& columns,
+                 R_xlen_t nSamples);
+
+    R_xlen_t
+    nSamples() const
+    {
+        return n;
+    }
+
+    R_xlen_t
+    nPars() const
+    {
+        return columns.size();
+    }
+
+    double
+    at(R_xlen_t sample,
+       R_xlen_t par) const
+    {
+        return columns[par][sample * stride];
+    }
+
+    // are all samples finite?
+    bool
+    allFinite() const;
+
+private:
+    std::vector<const double*> columns;
+    R_xlen_t n;
+    R_xlen_t stride;
+};
+
+// the pointwise empirical HPD intervals of the parameters, as 2 x nPars matrix
+// (lower bounds in the first, upper bounds in the second row)
+DoubleVector
+empiricalHpds(const SampleMatrix& samples,
+              double level);
+
+// the HPD SCB around the mode vector: the parameterwise ranges of the samples with
+// maximum distance rank not larger than the level quantile of all maximum ranks
+DoubleVector
+scrHpdBand(const SampleMatrix& samples,
+           const DoubleVector& mode,
+           double level);
+
+// the SCB of Besag et al. (1995), from the parameterwise order statistics
+DoubleVector
+scrBesagBand(const SampleMatrix& samples,
+             double level);
+
+// Chunked input: the samples arrive in chunks, e.g. when they are simulated chunk by
+// chunk, and are appended column by column. The band is then computed by the same engine,
+// so the R side never holds the full samples matrix or any matrix derived from it.
+// This is not a streaming computation: the ranks need all samples, so they are all kept
+// here, and the memory is that of one full samples matrix.
+class BandStream
+{
+public:
+    // for an HPD band, the mode vector must be known in advance,
+    // and it must be empty for the Besag band.
+    BandStream(PosInt nPars,
+               const DoubleVector& mode);
+
+    // append the rows of the chunk, a nrow x nPars column-major matrix
+    void
+    add(const double* chunk,
+        R_xlen_t nrow);
+
+    PosInt
+    nPars() const
+    {
+        return columns.size();
+    }
+
+    R_xlen_t
+    nSamples() const
+    {
+        return columns.empty() ? 0 : columns.front().size();
+    }
+
+    // the band from all samples added so far
+    DoubleVector
+    band(double level) const;
+
+private:
+    const DoubleVector mode;
+    std::vector<DoubleVector> columns;
+};
+
+#endif /* CREDIBLEBANDS_H_ */
@@ -1,5 +1,4 @@
 #include "dataStructure.h"
-#include "RnewMat.h"
 #include "sum.h"
 #include <set>
 #include "mytypes.h"
@@ -7,7 +6,9 @@
 #include <cassert>
 #include <algorithm>
 #include <numeric>
+#include <stdexcept>
 #include "rcppExport.h"
+#include "sufficientStats.h"
 
 using std::lexicographical_compare;
 using std::pair;
@@ -81,6 +82,24 @@ int modelPar::size() const
 	return fpSize + ucSize;
 }
 
+void modelPar::save(CheckpointWriter& checkpoint) const
+{
+	checkpoint.write(fpPars);
+	checkpoint.write(nFps);
+	checkpoint.write(fpSize);
+	checkpoint.write(ucPars);
+	checkpoint.write(ucSize);
+}
+
+void modelPar::restore(CheckpointReader& checkpoint)
+{
+	checkpoint.read(fpPars);
+	checkpoint.read(nFps);
+	checkpoint.read(fpSize);
+	checkpoint.read(ucPars);
+	checkpoint.read(ucSize);
+}
+
 List
 modelPar::convert2list(const fpInfo& currFp) const
 {
@@ -171,30 +190,60 @@ SEXP model::convert2list(const fpInfo& currFp,
 
 // dataValues //
 
-dataValues::dataValues(const Matrix &x, const Matrix &xcentered, const ColumnVector &y, const double &totalNum) : 
-	design(x), centeredDesign(xcentered), response(y), totalNumber(static_cast<map<modelPar, modelInfo>::size_type>(totalNum)) 
+// the matrices and the response are views of the memory of x, xcentered and y,
+// which must therefore stay alive as long as this object.
+dataValues::dataValues(const AMatrix &x, const AMatrix &xcentered, const AVector &y, const double &totalNum,
+                       const SufficientStats* stats) :
+	design(const_cast<double*>(x.memptr()), x.n_rows, x.n_cols, false, true),
+	centeredDesign(const_cast<double*>(xcentered.memptr()), xcentered.n_rows, xcentered.n_cols, false, true),
+	response(const_cast<double*>(y.memptr()), y.n_elem, false, true),
+	totalNumber(static_cast<map<modelPar, modelInfo>::size_type>(totalNum)),
+	stats(stats)
 {
+	if(stats){
+		// number of observations and SST from the sufficient statistics
+		nObs = stats->nObs;
+		sumOfSquaresTotal = stats->sumOfSquaresTotal();
+		return;
+	}
+
 	// number of observations
-	nObs = design.Nrows();
+	nObs = design.n_rows;
 
 	// nObs long vector of ones
-	onesVector = ColumnVector(nObs);
-	onesVector = 1.0;
+	onesVector = arma::ones<AVector>(nObs);
 	
 	// and the SST
-	ColumnVector centeredResponse = response - (response.sum() / nObs) * onesVector;
-	sumOfSquaresTotal = centeredResponse.sum_square();   	
+	AVector centeredResponse = response - arma::sum(response) / nObs;
+	sumOfSquaresTotal = arma::dot(centeredResponse, centeredResponse);
 }	
 
 
 // fpInfo //
 
+DoubleVector
+getPowerset(int biggestMaxDegree)
+{
+    DoubleVector powerset(max(8, 5 + biggestMaxDegree));
+
+    // corresponding indices        0   1     2  3    4  5  6  7
+    const double fixedpowers[] = { -2, -1, -0.5, 0, 0.5, 1, 2, 3 }; // always in powerset
+
+    copy(fixedpowers, fixedpowers + 8,
+         inserter(powerset, powerset.begin()));
+    for(int more = 3; more < biggestMaxDegree; more++){ // additional powers
+        powerset.at(8 + (3 - more)) = more + 1;
+    }
+
+    return powerset;
+}
+
 fpInfo::fpInfo(SEXP R_nFps,
                SEXP R_fpcards,
                SEXP R_fppos,
                SEXP R_fpmaxs,
                SEXP R_fpnames,
-               const Matrix& x) :
+               const AMatrix& x) :
                nFps(INTEGER(R_nFps)[0]),
                fpcards(INTEGER(R_fpcards)),
                fppos(INTEGER(R_fppos)),
@@ -202,21 +251,12 @@ fpInfo::fpInfo(SEXP R_nFps,
                biggestMaxDegree(*max_element(fpmaxs,
                                              fpmaxs + Rf_length(R_fpmaxs))),
                maxFpDim(accumulate(fpmaxs, fpmaxs + nFps, 0)),
-               powerset(max(8, 5 + biggestMaxDegree)),
+               powerset(getPowerset(biggestMaxDegree)),
                fpnames(R_fpnames),
                numberPossibleFps(),
                linearPowers(),
-               tcols(nFps)
+               basis(nFps)
 {
-    // corresponding indices        0   1     2  3    4  5  6  7
-    const double fixedpowers[] = { -2, -1, -0.5, 0, 0.5, 1, 2, 3 }; // always in powerset
-
-    copy(fixedpowers, fixedpowers + 8,
-         inserter(powerset, powerset.begin()));
-    for(int more = 3; more < biggestMaxDegree; more++){ // additional powers
-        powerset.at(8 + (3 - more)) = more + 1;
-    }
-
     // numbers of possible univariate fps?
     for(PosInt i=0; i != nFps; ++i)
     {
@@ -231,39 +271,61 @@ fpInfo::fpInfo(SEXP R_nFps,
     // insert the index 5 for linear power 1
     linearPowers.insert(5);
 
-    // build array of vectors of ColumnVectors holding the required
-    // transformed values for the design matrices
+    // build the cache of all centered FP basis columns
     for (PosInt i = 0; i != nFps; i++){ // for every fp term
         const int nCols = fpcards[i];
-        const ColumnVector thisCol = x.Column(fppos[i]);
-        vector<ColumnVector> thisFp;
+        const AVector thisCol = x.col(fppos[i] - 1); // fppos is 1-based
+        const AVector logCol = arma::log(thisCol);
+        vector<AVector> thisFp;
         for (int j = 0; j != nCols; j++){ // for every possible power
-            ColumnVector thisTransform = thisCol;
+            AVector thisTransform = thisCol;
             double thisPower = powerset.at(j);
             if(thisPower){ // not 0
-                for (int k = 0; k != thisTransform.Nrows(); k++){ // transform each element
-                    assert(thisTransform.element(k) > 0);
-                    thisTransform.element(k) = pow(thisTransform.element(k), thisPower);
-                    assert(! ISNAN(thisTransform.element(k)));
+                for (PosInt k = 0; k != thisTransform.n_elem; k++){ // transform each element
+                    assert(thisTransform(k) > 0);
+                    thisTransform(k) = pow(thisTransform(k), thisPower);
+                    assert(! ISNAN(thisTransform(k)));
                 }
             } else { // 0
-                for (int k = 0; k != thisTransform.Nrows(); k++){
-                    assert(thisTransform.element(k) > 0);
-                    thisTransform.element(k) = log(thisTransform.element(k));
-                    assert(! ISNAN(thisTransform.element(k)));
+                for (PosInt k = 0; k != thisTransform.n_elem; k++){
+                    assert(thisTransform(k) > 0);
+                    thisTransform(k) = log(thisTransform(k));
+                    assert(! ISNAN(thisTransform(k)));
                 }
             }
-            // do not! center the column. This is done inside getFpMatrix, because
-            // the repeated powers case cannot be treated here!!
-
             // and put it into vector of columns
             thisFp.push_back(thisTransform);
         }
-        tcols.at(i) = thisFp;
+
+        // now all repeat levels: a repeated power is multiplied once more with the
+        // log column, which also covers the repeated log power because
+        // the log column itself is its first level. Then center each column.
+        AMatrix& thisBasis = basis.at(i);
+        thisBasis.set_size(x.n_rows, nCols * fpmaxs[i]);
+        for (int j = 0; j != nCols; j++){
+            AVector thisLevel = thisFp.at(j);
+            for (int repeat = 0; repeat != fpmaxs[i]; repeat++){
+                if (repeat > 0)
+                    thisLevel %= logCol;
+                thisBasis.col(repeat * nCols + j) = thisLevel - arma::sum(thisLevel) / x.n_rows;
+            }
+        }
     }
 }
 
 
+const double*
+fpInfo::basisColumn(PosInt i, int powerInd, int repeat) const
+{
+    // (a standard exception, because this is also called in parallel regions,
+    // where Rcpp exceptions cannot be constructed)
+    if (repeat >= fpmaxs[i])
+        throw std::out_of_range("fpInfo::basisColumn: power repeated more often than the maximum degree allows");
+
+    return basis.at(i).colptr(repeat * fpcards[i] + powerInd);
+}
+
+
 DoubleVector
 fpInfo::inds2powers(const Powers& m) const // convert inds m (a "Powers" object) into powers vector p (a DoubleVector)
 {
@@ -434,6 +496,58 @@ ModelCache::incrementFrequency(const modelPar& par)
         ret->second.hits++;
 }
 
+// save all cached models to a checkpoint
+void
+ModelCache::save(CheckpointWriter& checkpoint) const
+{
+    checkpoint.write(static_cast<PosLargeInt>(modelMap.size()));
+
+    for(MapType::const_iterator
+            m = modelMap.begin();
+            m != modelMap.end();
+            ++m)
+    {
+        m->first.save(checkpoint);
+
+        const modelInfo& info = m->second;
+        checkpoint.write(info.logMargLik);
+        checkpoint.write(info.logPrior);
+        checkpoint.write(info.postExpectedg);
+        checkpoint.write(info.postExpectedShrinkage);
+        checkpoint.write(info.R2);
+        checkpoint.write(info.hits);
+    }
+}
+
+// replace the cached models by those from a checkpoint
+void
+ModelCache::restore(CheckpointReader& checkpoint)
+{
+    modelIterSet.clear();
+    modelMap.clear();
+
+    PosLargeInt nModels;
+    checkpoint.read(nModels);
+
+    for(; nModels != 0; --nModels)
+    {
+        modelPar par;
+        par.restore(checkpoint);
+
+        double logMargLik, logPrior, postExpectedg, postExpectedShrinkage, R2;
+        unsigned long int hits;
+
+        checkpoint.read(logMargLik);
+        checkpoint.read(logPrior);
+        checkpoint.read(postExpectedg);
+        checkpoint.read(postExpectedShrinkage);
+        checkpoint.read(R2);
+        checkpoint.read(hits);
+
+        insert(par, modelInfo(logMargLik, logPrior, postExpectedg, postExpectedShrinkage, R2, hits));
+    }
+}
+
 // compute the log normalising constant from all cached models
 long double
 ModelCache::getLogNormConstant() const
@@ -620,3 +734,135 @@ ModelCache::getListOfBestModels(const fpInfo& currFp,
     // return
     return ret;
 }
+
+// ***************************************************************************************************//
+
+void modelmcmc::initIndexSets(PosInt nFps, PosInt nUcGroups)
+{
+	freeCovs = DenseIndexSet(nFps + 1);
+	presentCovs = DenseIndexSet(nFps + 1);
+	freeUcs = DenseIndexSet(nUcGroups);
+}
+
+// ***************************************************************************************************//
+
+ucGroupSizes::ucGroupSizes(const std::vector<PosInt>& sizes) :
+	sizes(sizes),
+	bySize()
+{
+	for (PosInt i = 1; i <= sizes.size(); i++){
+		if (bySize.size() <= sizes[i - 1])
+			bySize.resize(sizes[i - 1] + 1);
+		bySize[sizes[i - 1]].push_back(i);
+	}
+}
+
+// ***************************************************************************************************//
+
+void modelmcmc::initFreeSets(const ucGroupSizes& ucGroups, const fpInfo& currFp, const PosInt& maxDim)
+{
+	for (PosInt i = 1; i <= ucGroups.sizes.size(); i++){ // for every uc index
+		// free if not already in model and enough space in design matrix
+		freeUcs.set(i, (modPar.ucPars.count(i) == 0) && (ucGroups.sizes[i - 1] <= maxDim - dim));
+	}
+
+	freeCovs.clear();
+	if (dim == maxDim)
+		return;
+
+	for (PosInt i = 0; i != modPar.nFps; i++){
+		freeCovs.set(i + 1, modPar.fpPars.at(i).size() < static_cast<PosInt>(currFp.fpmaxs[i]));
+	}
+
+	freeCovs.set(modPar.nFps + 1, ! freeUcs.empty());
+}
+
+// ***************************************************************************************************//
+
+void modelmcmc::updateFreeUcs(const ucGroupSizes& ucGroups, const PosInt& maxDim, PosInt oldDim, PosInt changedUc)
+{
+	const PosInt oldSpace = maxDim - oldDim;
+	const PosInt space = maxDim - dim;
+
+	// the groups which fit into exactly one of the two spaces
+	if (! ucGroups.bySize.empty()){
+		const PosInt first = min(oldSpace, space) + 1;
+		const PosInt last = min(max(oldSpace, space), static_cast<PosInt>(ucGroups.bySize.size() - 1));
+		for (PosInt s = first; s <= last; s++){
+			for (std::vector<PosInt>::const_iterator i = ucGroups.bySize[s].begin(); i != ucGroups.bySize[s].end(); ++i){
+				freeUcs.set(*i, (modPar.ucPars.count(*i) == 0) && (s <= space));
+			}
+		}
+	}
+
+	if (changedUc > 0)
+		freeUcs.set(changedUc, (modPar.ucPars.count(changedUc) == 0) && (ucGroups.sizes.at(changedUc - 1) <= space));
+}
+
+// ***************************************************************************************************//
+
+void modelmcmc::updateFreeCovs(const fpInfo& currFp, const PosInt& maxDim, PosInt oldDim,
+                               PosInt changedFp1, PosInt changedFp2)
+{
+	if (dim == maxDim){
+		freeCovs.clear();
+		return;
+	}
+
+	if (oldDim == maxDim){ // the set was cleared at the limit
+		for (PosInt i = 0; i != modPar.nFps; i++){
+			freeCovs.set(i + 1, modPar.fpPars.at(i).size() < static_cast<PosInt>(currFp.fpmaxs[i]));
+		}
+	} else {
+		const PosInt changed[2] = {changedFp1, changedFp2};
+		for (int j = 0; j != 2; j++){
+			if ((changed[j] > 0) && (changed[j] <= modPar.nFps))
+				freeCovs.set(changed[j], modPar.fpPars.at(changed[j] - 1).size() <
+				                         static_cast<PosInt>(currFp.fpmaxs[changed[j] - 1]));
+		}
+	}
+
+	freeCovs.set(modPar.nFps + 1, ! freeUcs.empty());
+}
+
+// ***************************************************************************************************//
+
+void modelmcmc::updatePresentCov(PosInt covInd)
+{
+	if (covInd <= modPar.nFps)
+		presentCovs.set(covInd, ! modPar.fpPars.at(covInd - 1).empty());
+	else
+		presentCovs.set(covInd, ! modPar.ucPars.empty());
+}
+
+// ***************************************************************************************************//
+
+void modelmcmc::save(CheckpointWriter& checkpoint) const
+{
+	modPar.save(checkpoint);
+	freeCovs.save(checkpoint);
+	presentCovs.save(checkpoint);
+	freeUcs.save(checkpoint);
+	checkpoint.write(dim);
+	checkpoint.write(birthprob);
+	checkpoint.write(deathprob);
+	checkpoint.write(moveprob);
+	checkpoint.write(logMargLik);
+	checkpoint.write(logPrior);
+}
+
+// ***************************************************************************************************//
+
+void modelmcmc::restore(CheckpointReader& checkpoint)
+{
+	modPar.restore(checkpoint);
+	freeCovs.restore(checkpoint);
+	presentCovs.restore(checkpoint);
+	freeUcs.restore(checkpoint);
+	checkpoint.read(dim);
+	checkpoint.read(birthprob);
+	checkpoint.read(deathprob);
+	checkpoint.read(moveprob);
+	checkpoint.read(logMargLik);
+	checkpoint.read(logPrior);
+}
@@ -6,9 +6,12 @@
 #include <set>
 #include <map>
 #include <vector>
-#include "RnewMat.h"
 #include <iterator>
 #include "mytypes.h"
+#include "denseIndexSet.h"
+#include "checkpoint.h"
+
+class SufficientStats;
 
 
 struct safeSum
@@ -56,6 +59,9 @@ struct book{
 };
 
 
+// the power set for FPs up to this maximum degree
+DoubleVector getPowerset(int biggestMaxDegree);
+
 struct fpInfo{ // collects all information on fractional polynomials needed to be passed down
 
     // number of FP terms, cardinality of their power sets, which position they have in the
@@ -80,8 +86,10 @@ struct fpInfo{ // collects all information on fractional polynomials needed to b
     // what is the multiset expressing a linear inclusion of a covariate?
     Powers linearPowers;
 
-    // array of vectors of ColumnVectors holding the required transformed values for the design matrices
-    ColumnVectorArray tcols;
+    // cache of all centered FP basis columns, one contiguous matrix per FP:
+    // column (repeat * fpcards[i] + powerInd) of basis[i] is the transform with
+    // power index powerInd, multiplied "repeat" times with the log column, and centered.
+    std::vector<AMatrix> basis;
 
     // ctr
     fpInfo(SEXP R_nFps,
@@ -89,10 +97,14 @@ struct fpInfo{ // collects all information on fractional polynomials needed to b
            SEXP R_fppos,
            SEXP R_fpmaxs,
            SEXP R_fpnames,
-           const Matrix& x);
+           const AMatrix& x);
 
     // convert inds m into power array p
     DoubleVector inds2powers(const Powers &m) const;
+
+    // the cached column of FP i for power index powerInd at the given repeat level
+    // (0 for the first occurrence of a power, 1 for the first repetition etc.)
+    const double* basisColumn(PosInt i, int powerInd, int repeat) const;
 };
 
 
@@ -141,6 +153,10 @@ struct modelPar{ // key: must have a strict weak ordering
 
 	Rcpp::List
 	convert2list(const fpInfo& currFp) const;
+
+	// save to a checkpoint, and restore from there
+	void save(CheckpointWriter& checkpoint) const;
+	void restore(CheckpointReader& checkpoint);
 };
 
 
@@ -157,23 +173,28 @@ struct hyperPriorPars{
 };
 
 struct dataValues{
-	Matrix design;
-	Matrix centeredDesign;
+	AMatrix design;
+	AMatrix centeredDesign;
 	
-	ColumnVector response;
+	AVector response;
 	double sumOfSquaresTotal;
 	
 	int nObs;
 	
-	ColumnVector onesVector;
+	AVector onesVector;
 	
 	typedef std::map<modelPar, modelInfo>::size_type NumberType;
 	NumberType totalNumber; // cardinality of model space
+
+	// in the out-of-core mode, the sufficient statistics replace the data,
+	// and the matrices above have no rows. Otherwise 0.
+	const SufficientStats* stats;
 	
-	dataValues(const Matrix &x,
-               const Matrix &xcentered,
-               const ColumnVector &y,
-               const double &totalNum);
+	dataValues(const AMatrix &x,
+               const AMatrix &xcentered,
+               const AVector &y,
+               const double &totalNum,
+               const SufficientStats* stats = 0);
 };
 
 
@@ -267,6 +288,14 @@ public:
                         long double logNormConst,
                         const book& bookkeep) const;
 
+    // save all cached models with their infos and sampling frequencies to a checkpoint,
+    // and replace the contents of the cache by those from a checkpoint
+    void
+    save(CheckpointWriter& checkpoint) const;
+
+    void
+    restore(CheckpointReader& checkpoint);
+
 
 private:
 
@@ -292,48 +321,52 @@ private:
     SetType modelIterSet;
 };
 
+// the sizes of the uc groups, and the (1-based) uc groups of each size, so that the
+// free uc groups can be updated only for the sizes where the fit into the design matrix changes
+struct ucGroupSizes{
+        explicit ucGroupSizes(const std::vector<PosInt>& sizes);
+
+        std::vector<PosInt> sizes; // number of columns of uc group i is sizes[i - 1]
+        std::vector<std::vector<PosInt> > bySize; // the uc groups with s columns are bySize[s]
+};
+
 struct modelmcmc{ // all information needed in mcmc function
         modelPar modPar;
-        std::set<unsigned int> freeCovs; // indices of free covs (starting from first fp with index 1 up to uc index = nFps + 1)
-        std::set<unsigned int> presentCovs; // analogue
-        std::set<int> freeUcs; // indices within uc groups, denoting the birthable ones
+        // the index sets are maintained incrementally by the sampler with the update functions below,
+        // so that random selection from them is O(1) and no memory is allocated per step.
+        DenseIndexSet freeCovs; // indices of free covs (starting from first fp with index 1 up to uc index = nFps + 1)
+        DenseIndexSet presentCovs; // analogue
+        DenseIndexSet freeUcs; // indices within uc groups, denoting the birthable ones
         unsigned int dim; // number of columns in this model's design matrix
         double birthprob, deathprob, moveprob; // move type probabilites, switchprob is 1-bprob-dprob-mprob.
         double logMargLik;
         double logPrior;
-};
 
-// delete a number from a set
-template <class T>
-typename std::set<T> removeElement(std::set<T> input, T element)
-{
-	typename std::set<T>::iterator iter = input.begin();
-    while( iter != input.end() )
-    {
-      if (*iter == element)
-        // A copy of iter is passed into erase(), ++ is executed after erase().
-        // Thus iter remains valid
-        input.erase( iter++ );
-      else
-        ++iter;
-    }
+        // allocate the index sets for nFps FPs and nUcGroups uc groups
+        void initIndexSets(PosInt nFps, PosInt nUcGroups);
 
-    return input;
-}
+        // compute the free uc groups and the free covs from scratch, for the start model
+        void initFreeSets(const ucGroupSizes& ucGroups, const fpInfo& currFp, const PosInt& maxDim);
 
-// construct a sequence 1:maximum
-template <class T>
-typename std::set<T> constructSequence(T maximum)
-{
-	std::set<T> ret;
+        // update the free uc groups in place, after the dimension changed from oldDim and the uc group
+        // changedUc (0 for none) entered or left the model. Only changedUc and the groups whose size
+        // lies between the old and the new free dimension are checked.
+        void updateFreeUcs(const ucGroupSizes& ucGroups, const PosInt& maxDim, PosInt oldDim, PosInt changedUc);
 
-	for(T i = 1; i <= maximum; ++i)
-	{
-		ret.insert(ret.end(), i);
-	}
+        // update the free covs in place, after the dimension changed from oldDim and the powers of the
+        // FPs changedFp1 and changedFp2 (0 for none) changed, using the current free uc groups.
+        // Only these FPs are checked, unless the model reached or left the dimension limit.
+        void updateFreeCovs(const fpInfo& currFp, const PosInt& maxDim, PosInt oldDim,
+                            PosInt changedFp1, PosInt changedFp2 = 0);
 
-	return ret;
-}
+        // update whether the cov covInd (fp index, or nFps + 1 for the uc groups) is present
+        void updatePresentCov(PosInt covInd);
+
+        // save the complete state to a checkpoint, and restore it
+        // (the index sets must have been allocated before)
+        void save(CheckpointWriter& checkpoint) const;
+        void restore(CheckpointReader& checkpoint);
+};
 
 
 #endif /*DATASTRUCTURE_H_*/
@@ -0,0 +1,207 @@
+/*
+ * denseIndexSet.h
+ *
+ *  Twin of glmBfp/src/denseIndexSet.h: changes must be made in both files, which only differ
+ *  in the include style and the type names of the two packages.
+ */
+
+#ifndef DENSEINDEXSET_H_
+#define DENSEINDEXSET_H_
+
+#include "mytypes.h"
+#include "rcppExport.h"
+#include "rngStreams.h"
+#include "checkpoint.h"
+#include <vector>
+#include <cmath>
+
+// ***************************************************************************************************//
+
+// Set of indices from the universe 1, ..., universeSize, as used for the free and present
+// covariates and the free UC groups in the model search.
+// The elements are kept in a dense array together with the position of each index in it,
+// so insertion, removal (swapping in the last element), membership tests and access by position
+// are all O(1), and nothing is allocated after construction.
+// The dense order is arbitrary; nthSmallest() gives access in increasing order.
+class DenseIndexSet
+{
+public:
+    explicit
+    DenseIndexSet(PosInt universeSize = 0) :
+        elements(),
+        positions(universeSize + 1, PosInt(notIncluded))
+    {
+        elements.reserve(universeSize);
+    }
+
+    PosInt
+    size() const
+    {
+        return elements.size();
+    }
+
+    bool
+    empty() const
+    {
+        return elements.empty();
+    }
+
+    bool
+    contains(PosInt index) const
+    {
+        return positions[index] != notIncluded;
+    }
+
+    void
+    insert(PosInt index)
+    {
+        if(! contains(index))
+        {
+            positions[index] = elements.size();
+            elements.push_back(index);
+        }
+    }
+
+    void
+    erase(PosInt index)
+    {
+        if(contains(index))
+        {
+            const PosInt pos = positions[index];
+            const PosInt last = elements.back();
+
+            elements[pos] = last;
+            positions[last] = pos;
+
+            elements.pop_back();
+            positions[index] = notIncluded;
+        }
+    }
+
+    // insert or erase index
+    void
+    set(PosInt index, bool included)
+    {
+        if(included)
+            insert(index);
+        else
+            erase(index);
+    }
+
+    void
+    clear()
+    {
+        for(std::vector<PosInt>::const_iterator e = elements.begin(); e != elements.end(); ++e)
+            positions[*e] = notIncluded;
+        elements.clear();
+    }
+
+    // the element at 0-based position pos of the dense array
+    PosInt
+    at(PosInt pos) const
+    {
+        return elements[pos];
+    }
+
+    // the element with 0-based rank in increasing order, leaving out "excluded".
+    // This walks the universe, so it is O(universeSize).
+    PosInt
+    nthSmallest(PosInt rank, PosInt excluded = 0) const
+    {
+        for(PosInt index = 1; index < positions.size(); ++index)
+        {
+            if(contains(index) && (index != excluded) && (rank-- == 0))
+                return index;
+        }
+
+        Rcpp::stop("\nrank too large in DenseIndexSet::nthSmallest\n");
+        return 0;
+    }
+
+    // save the elements in their dense order to a checkpoint, and restore them,
+    // so that the random selection continues exactly
+    void
+    save(CheckpointWriter& checkpoint) const
+    {
+        checkpoint.write(elements);
+    }
+
+    void
+    restore(CheckpointReader& checkpoint)
+    {
+        std::vector<PosInt> saved;
+        checkpoint.read(saved);
+
+        clear();
+        for(std::vector<PosInt>::const_iterator e = saved.begin(); e != saved.end(); ++e)
+        {
+            if((*e == 0) || (*e >= positions.size()))
+                Rcpp::stop("\nindex out of range in DenseIndexSet::restore\n");
+            insert(*e);
+        }
+    }
+
+private:
+    static const PosInt notIncluded = static_cast<PosInt>(-1);
+
+    std::vector<PosInt> elements;
+    std::vector<PosInt> positions;
+};
+
+// ***************************************************************************************************//
+
+// get the 0-based rank of a random element out of size elements:
+// the smallest j with u <= j / size, exactly as found by the linear walk in discreteUniform.
+inline PosInt
+uniformRank(PosInt size, RngStream& rng)
+{
+    const double u = rng.unif();
+
+    PosInt j = static_cast<PosInt>(std::ceil(u * size));
+    if(j < 1)
+        j = 1;
+    else if(j > size)
+        j = size;
+
+    // correct for rounding in the multiplication
+    while((j > 1) && (u <= 1.0 / size * (j - 1)))
+        --j;
+    while((j < size) && (u > 1.0 / size * j))
+        ++j;
+
+    return j - 1;
+}
+
+// return a random element of the set, leaving out "excluded" if it is contained.
+// The counter-based stream picks by position in O(1). The legacy stream picks in
+// increasing order, as the former std::set based version, to reproduce old chains.
+// Should be enclosed in getRNGstate() etc. for the legacy stream.
+inline PosInt
+discreteUniform(const DenseIndexSet& set, RngStream& rng, PosInt excluded = 0)
+{
+    const bool skip = (excluded > 0) && set.contains(excluded);
+    const PosInt size = set.size() - skip;
+
+    if(size == 0)
+    {
+        Rcpp::stop("\nset in call to discreteUniform is empty!\n");
+    }
+
+    const PosInt rank = uniformRank(size, rng);
+
+    if(rng.isLegacy())
+    {
+        return set.nthSmallest(rank, excluded);
+    }
+    else
+    {
+        // if we hit the excluded element, take the last one instead,
+        // which is not in the range of positions otherwise.
+        const PosInt ret = set.at(rank);
+        return (skip && (ret == excluded)) ? set.at(size) : ret;
+    }
+}
+
+// ***************************************************************************************************//
+
+#endif /* DENSEINDEXSET_H_ */
@@ -0,0 +1,132 @@
+/*
+ * design.cpp
+ */
+
+#include "design.h"
+#include "dataStructure.h"
+#include "mytypes.h"
+
+#include <algorithm>
+
+using std::set;
+using std::vector;
+
+
+// get different concatenated columns of matrix
+AMatrix
+getMultipleCols(const AMatrix& m,
+                const set<int>& s) // expect that the column numbers s are 1-based!
+{
+    AMatrix ret(m.n_rows, s.size());
+
+    set<int>::size_type cols = 0; // invariant: about to process column nr. "cols"
+    for (set<int>::const_iterator i = s.begin(); i != s.end(); i++)
+    {
+        ret.col(cols++) = m.col(*i - 1); // so we must subtract 1 here
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+// copy the centered FP columns for FP number fp and power indices from the basis cache
+// into ret, starting at column firstColumn. No arithmetic is needed: the
+// multiset is ordered, so repeated powers are adjacent and only the repeat level
+// has to be counted.
+static void
+gatherFpColumns(AMatrix& ret,
+                PosInt firstColumn,
+                const fpInfo& currFp,
+                const PosInt fp,
+                const Powers& powerinds)
+{
+    const PosInt nrow = ret.n_rows;
+
+    int lastInd = -1;
+    int repeat = 0;
+
+    for (Powers::const_iterator now = powerinds.begin(); now != powerinds.end(); now++)
+    {
+        repeat = (*now == lastInd) ? repeat + 1 : 0;
+        lastInd = *now;
+
+        const double* source = currFp.basisColumn(fp, lastInd, repeat);
+        std::copy(source, source + nrow, ret.colptr(firstColumn++));
+    }
+}
+
+// build Fp basis matrix for FP number fp and power indices,
+// gathered from the basis cache in currFp
+AMatrix
+getFpMatrix(const fpInfo& currFp,
+            const PosInt fp,
+            const Powers& powerinds)
+{
+    AMatrix ret(currFp.basis.at(fp).n_rows, powerinds.size());
+    gatherFpColumns(ret, 0, currFp, fp, powerinds);
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+// construct centered design matrix including intercept for the model
+AMatrix
+getDesignMatrix(const modelPar &mod,
+                const dataValues &data,
+                const fpInfo &currFp,
+                const vector<IntSet>& ucTermList,
+                const int &nUcGroups,
+                const set<int> &fixedCols)
+{
+    // total number of columns: intercept, FP powers and UC columns
+    PosInt nColumns = 1 + mod.fpSize;
+    for (set<int>::const_iterator g = mod.ucPars.begin(); g != mod.ucPars.end(); ++g)
+    {
+        nColumns += ucTermList.at(*g - 1).size();
+    }
+
+    // initialize the return matrix, so that no concatenation is necessary
+    AMatrix ret(data.nObs, nColumns);
+
+    // start with the intercept column
+    ret.col(0) = data.onesVector;
+
+    // invariant: nextColumn is the next column to be written
+    PosInt nextColumn = 1;
+
+    // centered fp matrices
+    for (PosInt i = 0; i != currFp.nFps; i++)
+    {
+        const Powers& powersi = mod.fpPars.at(i);
+
+        // insert the centered FP columns directly into the return matrix
+        gatherFpColumns(ret, nextColumn, currFp, i, powersi);
+
+        // correct invariant
+        nextColumn += powersi.size();
+    }
+
+    // centered uc matrices (ucPars is ordered, as was the former loop over all groups)
+    for (set<int>::const_iterator g = mod.ucPars.begin(); g != mod.ucPars.end(); ++g)
+    {
+        // what is the column list for this group?
+        const IntSet& thisColList = ucTermList.at(*g - 1);
+
+        // what is the end column in the return matrix?
+        PosInt endColumn = nextColumn + thisColList.size() - 1;
+
+        // insert the centered UC matrix into the return matrix
+        ret.cols(nextColumn, endColumn) = getMultipleCols(data.centeredDesign, thisColList);
+
+        // correct invariant
+        nextColumn = endColumn + 1;
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+
+// End of file.
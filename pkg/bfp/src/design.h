@@ -0,0 +1,40 @@
+/*
+ * design.h
+ *
+ *  Construction of the centered design matrices, formerly done with newmat.
+ */
+
+#ifndef DESIGN_H_
+#define DESIGN_H_
+
+#include "dataStructure.h"
+#include "mytypes.h"
+
+#include <set>
+#include <vector>
+
+
+// get different concatenated columns of matrix
+// (the column numbers are 1-based)
+AMatrix
+getMultipleCols(const AMatrix& m,
+                const std::set<int>& s);
+
+// build Fp basis matrix for FP number fp and power indices,
+// gathered from the basis cache in currFp
+AMatrix
+getFpMatrix(const fpInfo& currFp,
+            const PosInt fp,
+            const Powers& powerinds);
+
+// construct centered design matrix including intercept for the model
+AMatrix
+getDesignMatrix(const modelPar &mod,
+                const dataValues &data,
+                const fpInfo &currFp,
+                const std::vector<IntSet>& ucTermList,
+                const int &nUcGroups,
+                const std::set<int> &fixedCols);
+
+
+#endif /* DESIGN_H_ */
@@ -110,3 +110,205 @@ double posteriorExpectedShrinkage_hyperg(double R2, int n, int p, double alpha,
 	
 	return(ret); 
 }
+
+
+// ***************************************************************************************************//
+
+// accumulates the log of a sum of exponentials, rescaling with the running maximum
+struct LogSumAccumulator
+{
+    double max;
+    double sum;
+
+    LogSumAccumulator() :
+        max(R_NegInf),
+        sum(0.0)
+    {
+    }
+
+    void
+    add(double logVal)
+    {
+        if (logVal > max)
+        {
+            sum = sum * exp(max - logVal) + 1.0;
+            max = logVal;
+        }
+        else
+        {
+            sum += exp(logVal - max);
+        }
+    }
+
+    double
+    logSum() const
+    {
+        return max + log(sum);
+    }
+};
+
+// compute log(1 + exp(x)) without overflow
+static inline double
+log1pexp(double x)
+{
+    return (x > 0.0) ? x + log1p(exp(- x)) : log1p(exp(x));
+}
+
+HypergEngine::HypergEngine(int n, double alpha) :
+    n(n),
+    alpha(alpha),
+    logConst(log(alpha / 2.0 - 1.0)),
+    e2((n - 1) / 2.0)
+{
+}
+
+const HypergEngine::DimConstants&
+HypergEngine::getConstants(int p)
+{
+    if (static_cast<int>(dimCache.size()) <= p)
+    {
+        DimConstants empty;
+        empty.computed = false;
+        dimCache.resize(p + 1, empty);
+    }
+
+    DimConstants& ret = dimCache[p];
+    if (! ret.computed)
+    {
+        double pmodel = p - 1; // now only the covariates without intercept
+
+        ret.e1 = (n - 1 - pmodel - alpha) / 2.0;
+        ret.q = (pmodel + alpha) / 2.0 - 2.0;
+        ret.computed = true;
+    }
+
+    return ret;
+}
+
+HypergResult
+HypergEngine::evaluate(double R2, int p)
+{
+    // NaN keys would break the ordering of the cache, and the special cases are cheap
+    if ((p == 1) || ISNAN(R2))
+        return integrate(R2, p);
+
+    const std::pair<int, double> key(p, R2);
+    ResultCache::const_iterator it = resultCache.find(key);
+    if (it != resultCache.end())
+        return it->second;
+
+    if (resultCache.size() >= maxCached)
+        resultCache.clear();
+
+    const HypergResult ret = integrate(R2, p);
+    resultCache.insert(ResultCache::value_type(key, ret));
+    return ret;
+}
+
+HypergResult
+HypergEngine::integrate(double R2, int p)
+{
+    HypergResult ret;
+
+    if (p == 1) // null model: no g here...
+    {
+        ret.logBF = ret.postExpectedg = ret.postExpectedShrinkage = 0.0;
+        return ret;
+    }
+    if (ISNAN(R2))
+    {
+        ret.logBF = ret.postExpectedg = ret.postExpectedShrinkage = R_NaN;
+        return ret;
+    }
+
+    const double k = 1.0 - R2;
+    if (! (k > 0.0)) // perfect fit: the integral diverges
+    {
+        ret.logBF = ret.postExpectedg = R_PosInf;
+        ret.postExpectedShrinkage = 1.0;
+        return ret;
+    }
+    const double logk = log(k);
+
+    const DimConstants& dim = getConstants(p);
+    const double e1 = dim.e1;
+    const bool finiteg = dim.q > 0.0;
+
+    // the log integrand over tau = log(g) is
+    // h(tau) = tau + e1 * log(1 + g) - e2 * log(1 + (1 - R2) g).
+
+    // its mode solves the quadratic equation A g^2 + B g + 1 = 0 in g:
+    const double A = - k * (dim.q + 1.0);
+    const double B = 1.0 + k + e1 - e2 * k;
+    const double sqrtD = sqrt(B * B - 4.0 * A);
+    const double gMode = (B > 0.0) ? (- B - sqrtD) / (2.0 * A) : 2.0 / (sqrtD - B);
+    const double tauMode = log(gMode);
+
+    // the curvature at the mode determines the step size
+    const double tMode = gMode / (1.0 + gMode);
+    const double sMode = k * gMode / (1.0 + k * gMode);
+    const double curvature = e2 * sMode * (1.0 - sMode) - e1 * tMode * (1.0 - tMode);
+    const double step = (curvature > 0.0) ? fmin(0.5, 1.0 / (3.0 * sqrt(curvature))) : 0.5;
+
+    // beyond this tau the log integrand is linear in tau up to a relative error of exp(-40)
+    const double tauLinear = 40.0 + log(fabs(e1) + e2 + 1.0) - logk;
+
+    // contributions below exp(-tolerance) times the maximum are negligible
+    const double tolerance = 40.0;
+
+    LogSumAccumulator sum0; // for the normalizing constant
+    LogSumAccumulator sumt; // for E(g / (1 + g))
+    LogSumAccumulator sumg; // for E(g)
+
+    // walk from the mode in both directions
+    for (int direction = 1; direction >= -1; direction -= 2)
+    {
+        for (int j = (direction == 1) ? 0 : 1; ; ++j)
+        {
+            const double tau = tauMode + direction * j * step;
+            const double L1 = log1pexp(tau);
+            const double h = tau + e1 * L1 - e2 * log1pexp(tau + logk);
+
+            sum0.add(h);
+            sumt.add(h + tau - L1);
+            if (finiteg)
+                sumg.add(h + tau);
+
+            if (direction == 1)
+            {
+                if ((h < sum0.max - tolerance) &&
+                    ((! finiteg) || (h + tau < sumg.max - tolerance)))
+                    break;
+
+                if (tau > tauLinear)
+                {
+                    // add the remaining geometric tail sums analytically:
+                    // the log integrand decreases with slope q + 1, and with slope q for E(g).
+                    const double logRatio0 = - (dim.q + 1.0) * step;
+                    const double logTail0 = logRatio0 - log1p(- exp(logRatio0));
+                    sum0.add(h + logTail0);
+                    sumt.add(h + tau - L1 + logTail0);
+                    if (finiteg)
+                    {
+                        const double logRatiog = - dim.q * step;
+                        sumg.add(h + tau + logRatiog - log1p(- exp(logRatiog)));
+                    }
+                    break;
+                }
+            }
+            else if (h < sum0.max - tolerance)
+            {
+                break;
+            }
+        }
+    }
+
+    // so the log integral is
+    const double logIntegral = log(step) + sum0.logSum();
+
+    ret.logBF = logConst + logIntegral;
+    ret.postExpectedShrinkage = exp(sumt.logSum() - sum0.logSum());
+    ret.postExpectedg = finiteg ? exp(sumg.logSum() - sum0.logSum()) : R_PosInf;
+
+    return ret;
+}
@@ -3,6 +3,9 @@
 
 #include <Rmath.h>
 #include <Rdefines.h>
+#include <vector>
+#include <map>
+#include <utility>
 
 #ifdef __cplusplus
 extern "C" {
@@ -21,5 +24,60 @@ double logBF_hyperg(double R2, int n, int p, double alpha);
 double posteriorExpectedg_hyperg(double R2, int n, int p, double alpha, double logBF);
 double posteriorExpectedShrinkage_hyperg(double R2, int n, int p, double alpha, double logBF);
 
+// all hyper-g quantities of one model, which are computed in one pass
+struct HypergResult
+{
+    double logBF; // log Bayes factor versus the null model
+    double postExpectedg; // posterior expected g
+    double postExpectedShrinkage; // posterior expected shrinkage factor g / (1 + g)
+};
+
+// evaluation engine for the hyper-g quantities, for fixed sample size n and hyperparameter alpha.
+// Instead of the Gauss hypergeometric function (and the Laplace approximation if that overflows),
+// the integral representation over tau = log(g) is evaluated with the trapezoidal rule in log space,
+// which gives all three quantities at once. The exponents, which only depend on the
+// model dimension p, are precomputed, and the results are cached by (p, R2), so that
+// models with the same fit (e.g. revisited models or FP transformations giving the same
+// R2) are only integrated once. The engine is not thread-safe.
+class HypergEngine
+{
+public:
+    HypergEngine(int n, double alpha);
+
+    // R2 = usual coefficient of determination,
+    // p = number of columns of X (including (!) intercept)
+    HypergResult
+    evaluate(double R2, int p);
+
+private:
+    // the integration itself
+    HypergResult
+    integrate(double R2, int p);
+
+    // quantities only depending on the model dimension
+    struct DimConstants
+    {
+        bool computed;
+        double e1; // exponent of (1 + g)
+        double q; // decay rate of the posterior of g in the upper tail, must be > 0 for finite E(g)
+    };
+
+    const DimConstants&
+    getConstants(int p);
+
+    const int n;
+    const double alpha;
+
+    const double logConst; // log(alpha/2 - 1)
+    const double e2; // exponent of (1 + (1 - R2) g), same for all dimensions
+
+    std::vector<DimConstants> dimCache;
+
+    // evaluated results by (p, R2), cleared when it reaches maxCached entries
+    typedef std::map<std::pair<int, double>, HypergResult> ResultCache;
+    ResultCache resultCache;
+    static const ResultCache::size_type maxCached = 100000;
+};
+
 
 #endif /*HYPERG_H_*/
@@ -0,0 +1,210 @@
+/*
+ * incrementalR2.cpp
+ */
+
+#include "incrementalR2.h"
+#include "design.h"
+#include "linalgInterface.h"
+#include "sufficientStats.h"
+
+using std::vector;
+
+// ***************************************************************************************************//
+
+IncrementalR2::IncrementalR2(const dataValues& data,
+                             const fpInfo& currFp,
+                             const vector<IntSet>& ucTermList) :
+    data(data),
+    currFp(currFp),
+    ucTermList(ucTermList),
+    stack(),
+    nCols(0),
+    X(),
+    candidates(),
+    L(),
+    u()
+{
+    // the largest possible number of non-intercept columns
+    PosInt maxCols = currFp.maxFpDim;
+    for (vector<IntSet>::const_iterator g = ucTermList.begin(); g != ucTermList.end(); ++g)
+        maxCols += g->size();
+
+    if (data.stats)
+        candidates.set_size(maxCols);
+    else
+        X.set_size(data.nObs, maxCols);
+    u.set_size(maxCols);
+}
+
+// ***************************************************************************************************//
+
+vector<IncrementalR2::Block>
+IncrementalR2::getBlocks(const modelPar& mod) const
+{
+    vector<Block> ret;
+
+    for (PosInt i = 0; i != currFp.nFps; i++)
+    {
+        const Powers& powersi = mod.fpPars.at(i);
+        if (! powersi.empty())
+        {
+            Block block = {static_cast<int>(i), powersi, 0, static_cast<PosInt>(powersi.size())};
+            ret.push_back(block);
+        }
+    }
+
+    for (std::set<int>::const_iterator g = mod.ucPars.begin(); g != mod.ucPars.end(); ++g)
+    {
+        Block block = {-1, Powers(), *g, static_cast<PosInt>(ucTermList.at(*g - 1).size())};
+        ret.push_back(block);
+    }
+
+    return ret;
+}
+
+AMatrix
+IncrementalR2::getColumns(const Block& block) const
+{
+    if (block.fp >= 0)
+        return getFpMatrix(currFp, block.fp, block.powers);
+    else
+        return getMultipleCols(data.centeredDesign, ucTermList.at(block.ucGroup - 1));
+}
+
+arma::uvec
+IncrementalR2::getCandidates(const Block& block) const
+{
+    vector<arma::uword> ret;
+
+    if (block.fp >= 0)
+    {
+        // count the repeat levels as in gatherFpColumns
+        int lastInd = -1;
+        int repeat = 0;
+        for (Powers::const_iterator now = block.powers.begin(); now != block.powers.end(); ++now)
+        {
+            repeat = (*now == lastInd) ? repeat + 1 : 0;
+            lastInd = *now;
+            ret.push_back(data.stats->fpColumn(block.fp, lastInd, repeat));
+        }
+    }
+    else
+    {
+        const IntSet& cols = ucTermList.at(block.ucGroup - 1);
+        for (IntSet::const_iterator c = cols.begin(); c != cols.end(); ++c)
+            ret.push_back(data.stats->designColumn(*c));
+    }
+
+    return arma::conv_to<arma::uvec>::from(ret);
+}
+
+// ***************************************************************************************************//
+
+void
+IncrementalR2::pop()
+{
+    nCols -= stack.back().nCols;
+    stack.pop_back();
+
+    L.resize(nCols, nCols);
+}
+
+bool
+IncrementalR2::push(const Block& block)
+{
+    // the cross products Z'Z, Z'y and X'Z of the new columns Z
+    AMatrix Z, S, zy, B;
+    arma::uvec zCandidates;
+    if (data.stats)
+    {
+        const AMatrix& gram = data.stats->gram;
+
+        zCandidates = getCandidates(block);
+        S = gram.submat(zCandidates, zCandidates);
+        zy = gram.submat(zCandidates, data.stats->responseIndex());
+        if (nCols > 0)
+            B = gram.submat(candidates.head(nCols), zCandidates);
+    }
+    else
+    {
+        Z = getColumns(block);
+        S = arma::zeros<AMatrix>(Z.n_cols, Z.n_cols);
+        syrk(false, true, Z, 0.0, S);
+        zy = Z.t() * data.response;
+        if (nCols > 0)
+            B = X.cols(0, nCols - 1).t() * Z;
+    }
+    const PosInt q = S.n_cols;
+
+    // the Schur complement S = Z'Z - B'B with B = L^{-1} X'Z, and Z'y - B'u
+    if (nCols > 0)
+    {
+        trs(false, false, L, B);
+
+        S -= B.t() * B;
+        zy -= B.t() * u.head(nCols);
+    }
+
+    // the Cholesky factor of S is the new diagonal block of L
+    if (potrf(false, S) != 0)
+        return false;
+    trs(false, false, S, zy);
+
+    // so the new rows of L are (B', chol(S))
+    L.resize(nCols + q, nCols + q);
+    if (nCols > 0)
+        L.submat(nCols, 0, nCols + q - 1, nCols - 1) = B.t();
+    L.submat(nCols, nCols, nCols + q - 1, nCols + q - 1) = arma::trimatl(S);
+
+    if (data.stats)
+        candidates.subvec(nCols, nCols + q - 1) = zCandidates;
+    else
+        X.cols(nCols, nCols + q - 1) = Z;
+    u.subvec(nCols, nCols + q - 1) = zy;
+
+    nCols += q;
+    stack.push_back(block);
+
+    return true;
+}
+
+// ***************************************************************************************************//
+
+double
+IncrementalR2::R2(const modelPar& mod,
+                  const hyperPriorPars& hyp,
+                  int& dim)
+{
+    const vector<Block> blocks = getBlocks(mod);
+
+    PosInt modCols = 0;
+    for (vector<Block>::const_iterator b = blocks.begin(); b != blocks.end(); ++b)
+        modCols += b->nCols;
+
+    // the same checks as in getR2
+    dim = 1 + modCols;
+    if (dim - 1 >= data.nObs - 3 - hyp.a)
+        return R_NaN; // not a valid model
+
+    if (modCols == 0)
+        return 0; // the null model
+
+    // keep the common bottom of the stack
+    vector<Block>::size_type common = 0;
+    while ((common < stack.size()) && (common < blocks.size()) && (stack[common] == blocks[common]))
+        ++common;
+
+    while (stack.size() > common)
+        pop();
+
+    // and push the remaining blocks
+    for (vector<Block>::size_type b = common; b != blocks.size(); ++b)
+    {
+        if (! push(blocks[b]))
+            return R_NaN; // X'X is not positive definite
+    }
+
+    return arma::accu(arma::square(u.head(nCols))) / data.sumOfSquaresTotal;
+}
+
+// End of incrementalR2.cpp
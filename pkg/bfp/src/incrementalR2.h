@@ -0,0 +1,92 @@
+/*
+ * incrementalR2.h
+ *
+ *  Incremental computation of the coefficient of determination along a sequence of
+ *  models, as visited by the minimal change (Gray code) enumeration of the exhaustive search.
+ */
+
+#ifndef INCREMENTALR2_H_
+#define INCREMENTALR2_H_
+
+#include "dataStructure.h"
+#include "mytypes.h"
+
+#include <vector>
+
+// The non-intercept columns of the centered design matrix consist of blocks:
+// the columns of one FP with its powers, or the columns of one UC group.
+// The Cholesky factor L of X'X and the vector L^{-1} X'y are kept for a stack of such blocks,
+// ordered as in the design matrix. The R2 of the next model then only needs to pop the
+// blocks which are not shared with it from the top of the stack, and to push its remaining
+// blocks with a bordered Cholesky update. Consecutive models of the Gray code enumeration
+// mostly differ in the topmost block only, so instead of a full cross product and
+// factorization per model, only the cross products of the new columns are needed.
+class IncrementalR2
+{
+public:
+    IncrementalR2(const dataValues& data,
+                  const fpInfo& currFp,
+                  const std::vector<IntSet>& ucTermList);
+
+    // compute the R2 of the model and the dimension of its design matrix.
+    // Invalid (too large or not identifiable) models give NaN, as getR2 does.
+    double
+    R2(const modelPar& mod,
+       const hyperPriorPars& hyp,
+       int& dim);
+
+private:
+    // one block of design matrix columns
+    struct Block
+    {
+        int fp;           // FP index, or -1 for a UC group
+        Powers powers;    // the FP powers
+        int ucGroup;      // the UC group (starting from 1), or 0 for an FP
+        PosInt nCols;
+
+        bool
+        operator==(const Block& b) const
+        {
+            return (fp == b.fp) && (ucGroup == b.ucGroup) && (powers == b.powers);
+        }
+    };
+
+    // the blocks of the model, in the order of the design matrix
+    std::vector<Block>
+    getBlocks(const modelPar& mod) const;
+
+    // the centered columns of a block
+    AMatrix
+    getColumns(const Block& block) const;
+
+    // the indices of the block columns in the sufficient statistics
+    arma::uvec
+    getCandidates(const Block& block) const;
+
+    // remove the top block
+    void
+    pop();
+
+    // append a block, and return false if the extended cross product is not positive definite.
+    // Then nothing is changed.
+    bool
+    push(const Block& block);
+
+    const dataValues& data;
+    const fpInfo& currFp;
+    const std::vector<IntSet>& ucTermList;
+
+    // the stack of blocks, with their columns X, the lower Cholesky factor L of X'X and
+    // u = L^{-1} X'y. X and u are allocated for the largest possible model,
+    // only their first nCols columns (elements) are used.
+    // With sufficient statistics, the cross products are taken from their Gram matrix,
+    // so instead of X only the indices of its columns in the statistics are kept.
+    std::vector<Block> stack;
+    PosInt nCols;
+    AMatrix X;
+    arma::uvec candidates;
+    AMatrix L;
+    AVector u;
+};
+
+#endif /* INCREMENTALR2_H_ */
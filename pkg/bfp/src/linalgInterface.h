@@ -0,0 +1,44 @@
+/*
+ * linalgInterface.h
+ *
+ *  Thin wrappers around the BLAS/LAPACK routines needed by the bfp core,
+ *  following the interface used in the glmBfp package.
+ */
+
+#ifndef LINALGINTERFACE_H_
+#define LINALGINTERFACE_H_
+
+#include "mytypes.h"
+
+
+// triangular solve of L * x = R
+// where L can be provided lower or upper-triangular and be transposed.
+// the solution is directly written into R.
+void
+trs(const bool upper,
+    const bool transpose,
+    const AMatrix& L,
+    AMatrix& R);
+
+// Cholesky decomposition of (symmetric) A,
+// which can either be provided in lower or upper-triangular storage.
+// Result will be in the same layout.
+// Returns an error code which should be zero if all went well.
+int
+potrf(const bool upper,
+      AMatrix& A);
+
+// Do a symmetric rank k update of C:
+// C := A * A' + beta * C
+// where C must be symmetric and can be provided in lower or upper-triangular storage.
+// Result will be in the same layout.
+// If transpose == true, then the crossproduct will be added, i.e., C := A' * A + beta*C.
+void
+syrk(const bool upper,
+     const bool transpose,
+     const AMatrix& A,
+     const double beta,
+     AMatrix& C);
+
+
+#endif /* LINALGINTERFACE_H_ */
@@ -0,0 +1,44 @@
+/*
+ * memoryUsage.cpp
+ */
+
+#include "memoryUsage.h"
+#include "rcppExport.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+
+double
+peakResidentMegabytes()
+{
+#ifdef _WIN32
+	return R_NaReal;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return R_NaReal;
+
+#ifdef __APPLE__
+	// bytes on Mac OS X
+	return usage.ru_maxrss / 1048576.0;
+#else
+	// kilobytes on Linux and the BSDs
+	return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+
+void
+MemoryReport::print() const
+{
+	Rprintf("\nData shared with R:                 %.1f MB", sharedBytes / 1048576.0);
+	Rprintf("\nData copies:                        %.1f MB", ownedBytes / 1048576.0);
+
+	const double peak = peakResidentMegabytes();
+	if (! ISNA(peak))
+		Rprintf("\nPeak resident memory:               %.1f MB", peak);
+	Rprintf("\n");
+}
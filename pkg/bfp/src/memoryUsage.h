@@ -0,0 +1,46 @@
+/*
+ * memoryUsage.h
+ *
+ *  Bookkeeping of the memory used by the data path.
+ */
+
+#ifndef MEMORYUSAGE_H_
+#define MEMORYUSAGE_H_
+
+#include "mytypes.h"
+
+
+// what of the data is shared with R and what has been copied
+class MemoryReport
+{
+public:
+	MemoryReport() : sharedBytes(0.0), ownedBytes(0.0) {}
+
+	// account for one Armadillo object
+	template<class T>
+	void
+	add(const T& object)
+	{
+		const double bytes = static_cast<double>(object.n_elem) * sizeof(double);
+		if (object.mem_state == 0)
+			ownedBytes += bytes;
+		else
+			sharedBytes += bytes;
+	}
+
+	// print the summary together with the peak resident memory so far
+	void
+	print() const;
+
+private:
+	double sharedBytes;
+	double ownedBytes;
+};
+
+// the high-water mark of the resident set size of this process in megabytes,
+// or NA if this is not available on the platform
+double
+peakResidentMegabytes();
+
+
+#endif /* MEMORYUSAGE_H_ */
@@ -0,0 +1,283 @@
+/*
+ * modelProposal.h
+ *
+ *  Twin of glmBfp/src/modelProposal.h: changes must be made in both files, which only differ
+ *  in the include style and the type names of the two packages.
+ */
+
+#ifndef MODELPROPOSAL_H_
+#define MODELPROPOSAL_H_
+
+#include "mytypes.h"
+#include "rcppExport.h"
+#include "rngStreams.h"
+#include "denseIndexSet.h"
+#include "checkpoint.h"
+#include <vector>
+#include <string>
+#include <chrono>
+
+// ***************************************************************************************************//
+
+// Adaptive proposal weights for the model space sampler.
+// During the first nAdapt iterations the usual uniform proposals are used, and the
+// inclusion frequencies of the covariates and the power frequencies of the FPs are recorded.
+// Then the weights are frozen: a birth picks covariate c with probability proportional
+// to its (smoothed) inclusion frequency p_c, a death proportional to 1 - p_c, and new FP powers
+// are drawn according to the power frequencies. Because the weights are fixed afterwards,
+// the chain stays a valid Metropolis-Hastings chain, and the proposal ratios account for the weights.
+// With nAdapt = 0 nothing changes compared to the uniform proposals.
+class ProposalWeights
+{
+public:
+    ProposalWeights(const PosIntVector& fpcards,
+                    PosLargeInt nAdapt);
+
+    // record the current model of the chain at iteration t, if this is in the adaptation
+    // phase. After the last adaptation iteration, the weights are frozen.
+    void
+    record(PosLargeInt t,
+           const PowersVector& fpPars,
+           bool ucPresent);
+
+    // the weights for picking covariate covInd (fp index, or nFps + 1 for the uc groups)
+    // in a birth or death move
+    double
+    birthWeight(PosInt covInd) const
+    {
+        return frozen ? inclusionWeights[covInd - 1] : 1.0;
+    }
+
+    double
+    deathWeight(PosInt covInd) const
+    {
+        return frozen ? (1.0 - inclusionWeights[covInd - 1]) : 1.0;
+    }
+
+    // the weight of power index powerInd for the FP covInd, and the sum over all its power indices
+    double
+    powerWeight(PosInt covInd,
+                Int powerInd) const
+    {
+        return frozen ? powerWeights[covInd - 1][powerInd] : 1.0;
+    }
+
+    double
+    powerWeightSum(PosInt covInd) const
+    {
+        return frozen ? 1.0 : static_cast<double>(fpcards[covInd - 1]);
+    }
+
+    // sum of the birth or death weights over a set of covariates
+    double
+    birthWeightSum(const DenseIndexSet& covs) const;
+
+    double
+    deathWeightSum(const DenseIndexSet& covs) const;
+
+    // draw covariates and powers. Without frozen weights, these are exactly
+    // the uniform draws, also in the legacy stream.
+    PosInt
+    drawBirthCov(const DenseIndexSet& freeCovs,
+                 RngStream& rng) const;
+
+    PosInt
+    drawDeathCov(const DenseIndexSet& presentCovs,
+                 RngStream& rng) const;
+
+    Int
+    drawPower(PosInt covInd,
+              RngStream& rng) const;
+
+    // save the learning state and the weights to a checkpoint, and restore them
+    void
+    save(CheckpointWriter& checkpoint) const;
+
+    void
+    restore(CheckpointReader& checkpoint);
+
+private:
+    // compute the weights from the recorded frequencies, and use them from now on
+    void
+    freeze();
+
+    // draw from covs with probabilities proportional to weights (indexed by cov - 1)
+    PosInt
+    drawWeighted(const DenseIndexSet& covs,
+                 const DoubleVector& weights,
+                 bool complement,
+                 RngStream& rng) const;
+
+    const PosIntVector fpcards;
+    const PosLargeInt nAdapt;
+    bool frozen;
+
+    // the counts for learning
+    PosLargeInt nRecorded;
+    std::vector<PosLargeInt> inclusionCounts;
+    std::vector<std::vector<PosLargeInt> > powerCounts;
+
+    // and the resulting weights
+    DoubleVector inclusionWeights;
+    std::vector<DoubleVector> powerWeights;
+};
+
+// ***************************************************************************************************//
+
+// Online batch means estimate of the effective sample size of a scalar trace,
+// without storing the trace. The batch size sqrt(length) needs the length in advance.
+class BatchMeans
+{
+public:
+    BatchMeans(PosLargeInt length);
+
+    void
+    add(double value);
+
+    // the effective sample size, or NA if it cannot be estimated
+    double
+    ess() const;
+
+    // save the state to a checkpoint, and restore it
+    void
+    save(CheckpointWriter& checkpoint) const;
+
+    void
+    restore(CheckpointReader& checkpoint);
+
+private:
+    PosLargeInt batchSize;
+    PosLargeInt nValues;
+    double sum, sumSquares;
+
+    double batchSum;
+    PosLargeInt nInBatch;
+
+    PosLargeInt nBatches;
+    double batchMeanSum, batchMeanSumSquares;
+};
+
+// ***************************************************************************************************//
+
+// efficiency diagnostics of the model space sampler: acceptance rate and effective sample
+// sizes (of the log posterior and the model dimension traces) per hour, so that
+// the uniform and the adaptive proposals can be compared. With parallel tempering,
+// the acceptance rates of the swaps between neighbouring replicas are recorded, too.
+class ChainDiagnostics
+{
+public:
+    // the chain has length iterations, and after the first nAdapt the
+    // traces are recorded. nReplicas is the number of tempered replicas.
+    ChainDiagnostics(PosLargeInt length,
+                     PosLargeInt nAdapt,
+                     PosInt nReplicas = 1);
+
+    void
+    record(PosLargeInt t,
+           bool accepted,
+           double logPost,
+           double modelDim);
+
+    // record a proposed swap between the replicas pair and pair + 1
+    void
+    recordSwap(PosInt pair,
+               bool accepted)
+    {
+        ++nSwapsProposed[pair];
+        nSwapsAccepted[pair] += accepted;
+    }
+
+    // convert to R list
+    Rcpp::List
+    convert2list() const;
+
+    // save the counters, traces and elapsed times to a checkpoint, and restore them.
+    // The times of a resumed chain continue from the saved ones.
+    void
+    save(CheckpointWriter& checkpoint) const;
+
+    void
+    restore(CheckpointReader& checkpoint);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    // the seconds elapsed since the time point from
+    double
+    secondsSince(Clock::time_point from) const
+    {
+        return std::chrono::duration<double>(Clock::now() - from).count();
+    }
+
+    const PosLargeInt nAdapt;
+    Clock::time_point start;
+    Clock::time_point startRecording;
+
+    // the seconds before the chain was resumed from a checkpoint
+    double previousSeconds, previousTotalSeconds;
+
+    PosLargeInt nProposed, nAccepted;
+    PosLargeInt nRecorded, nRecordedAccepted;
+
+    BatchMeans logPosterior;
+    BatchMeans dim;
+
+    std::vector<PosLargeInt> nSwapsProposed, nSwapsAccepted;
+};
+
+// ***************************************************************************************************//
+
+// The anytime mode of the model space sampler: besides after chainlength iterations, the chain
+// stops as soon as the wall-clock budget or the budget of model evaluations is exhausted, or
+// when the estimated inclusion probabilities of the covariate groups (their frequencies in the
+// cold chain) have changed by less than epsilon over the last window iterations.
+// The budgets count from the start of this run, also for a resumed chain.
+class AnytimeStop
+{
+public:
+    AnytimeStop(double maxSeconds, // (infinite for no limit)
+                double maxEvaluations, // (infinite for no limit)
+                double epsilon, // (0 for no convergence criterion)
+                PosLargeInt window,
+                PosInt nGroups);
+
+    // is the convergence criterion used, so that stop() needs the included groups?
+    bool
+    checksConvergence() const
+    {
+        return epsilon > 0.0;
+    }
+
+    // after an iteration of the chain, with the included groups of the cold chain model and
+    // the number of models evaluated so far: shall the chain stop now?
+    bool
+    stop(const std::vector<bool>& included,
+         PosLargeInt nEvaluations);
+
+    // why did the chain stop? "chainlength" if it was not stopped early.
+    const std::string&
+    getReason() const
+    {
+        return reason;
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    const double maxSeconds;
+    const double maxEvaluations;
+    const double epsilon;
+    const PosLargeInt window;
+    const Clock::time_point start;
+
+    // the inclusion counts of the groups, and the estimates at the end of the last window
+    PosLargeInt nRecorded;
+    std::vector<PosLargeInt> counts;
+    std::vector<double> lastEstimates;
+
+    std::string reason;
+};
+
+// ***************************************************************************************************//
+
+#endif /* MODELPROPOSAL_H_ */
@@ -0,0 +1,199 @@
+/*
+ * modelStore.cpp
+ */
+
+#include "modelStore.h"
+#include "checkpoint.h"
+#include <fstream>
+
+using namespace Rcpp;
+
+// ***************************************************************************************************//
+
+// the 64 bit FNV-1a hash of the bytes, starting from the offset basis
+static unsigned long long
+fnv1a(const Rbyte* bytes,
+      R_xlen_t n,
+      unsigned long long offsetBasis)
+{
+    unsigned long long hash = offsetBasis;
+    for(R_xlen_t i = 0; i != n; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// the key from the fingerprint: two hashes with different offset bases
+static ModelStoreKey
+computeKey(SEXP fingerprint)
+{
+    const Rbyte* bytes = (TYPEOF(fingerprint) == RAWSXP) ? RAW(fingerprint) : NULL;
+    const R_xlen_t n = (bytes != NULL) ? Rf_xlength(fingerprint) : 0;
+
+    return ModelStoreKey(fnv1a(bytes, n, 14695981039346656037ULL),
+                         fnv1a(bytes, n, 7809847782465536322ULL));
+}
+
+// ***************************************************************************************************//
+
+ModelStore::ModelStore(const std::string& fileName,
+                       SEXP fingerprint) :
+    fileName(fileName),
+    key(computeKey(fingerprint)),
+    records(),
+    added(),
+    rewrite(false),
+    nLoaded(0),
+    nFound(0),
+    nAdded(0)
+{
+    // a new store starts empty
+    if(! active() || ! std::ifstream(fileName.c_str()))
+        return;
+
+    CheckpointReader file(fileName, DoubleVector(), "model store");
+
+    try
+    {
+        while(! file.atEnd())
+        {
+            // the records of a block are only taken when the block is complete
+            PosLargeInt nRecords;
+            file.read(nRecords);
+
+            std::vector<std::pair<MapType::key_type, MapType::mapped_type> > block;
+
+            for(; nRecords != 0; --nRecords)
+            {
+                ModelStoreKey recordKey;
+                file.read(recordKey);
+
+                modelPar par;
+                par.restore(file);
+
+                double R2;
+                int dim;
+                file.read(R2);
+                file.read(dim);
+
+                block.push_back(std::make_pair(std::make_pair(recordKey, par), std::make_pair(R2, dim)));
+            }
+
+            for(PosLargeInt i = 0; i != block.size(); ++i)
+            {
+                if(records.insert(block[i]).second)
+                    nLoaded += (block[i].first.first == key);
+            }
+        }
+    }
+    catch(std::exception&)
+    {
+        // an incomplete last block: keep the complete blocks, and rewrite the file at the next flush
+        Rf_warning("model store file %s ends with an incomplete block, which is dropped",
+                   fileName.c_str());
+        rewrite = true;
+    }
+}
+
+// ***************************************************************************************************//
+
+bool
+ModelStore::find(const modelPar& par,
+                 double& R2,
+                 int& dim)
+{
+    if(! active())
+        return false;
+
+    MapType::const_iterator r = records.find(std::make_pair(key, par));
+    if(r == records.end())
+        return false;
+
+    ++nFound;
+    R2 = r->second.first;
+    dim = r->second.second;
+    return true;
+}
+
+void
+ModelStore::add(const modelPar& par,
+                double R2,
+                int dim)
+{
+    if(! active())
+        return;
+
+    std::pair<MapType::iterator, bool> inserted =
+            records.insert(MapType::value_type(std::make_pair(key, par), std::make_pair(R2, dim)));
+    if(inserted.second)
+    {
+        added.push_back(inserted.first);
+        ++nAdded;
+    }
+}
+
+// ***************************************************************************************************//
+
+void
+ModelStore::writeRecord(CheckpointWriter& file,
+                        const MapType::value_type& r)
+{
+    file.write(r.first.first);
+    r.first.second.save(file);
+    file.write(r.second.first);
+    file.write(r.second.second);
+}
+
+void
+ModelStore::flush()
+{
+    if(! active() || (added.empty() && ! rewrite))
+        return;
+
+    if(! rewrite && std::ifstream(fileName.c_str()))
+    {
+        // append a block with the new records to the existing file
+        CheckpointWriter file(fileName, DoubleVector(), "model store", true);
+
+        file.write(static_cast<PosLargeInt>(added.size()));
+        for(PosLargeInt i = 0; i != added.size(); ++i)
+        {
+            writeRecord(file, *added[i]);
+        }
+
+        file.commit();
+    }
+    else
+    {
+        // (re)write the whole store as one block
+        CheckpointWriter file(fileName, DoubleVector(), "model store");
+
+        file.write(static_cast<PosLargeInt>(records.size()));
+        for(MapType::const_iterator r = records.begin(); r != records.end(); ++r)
+        {
+            writeRecord(file, *r);
+        }
+
+        file.commit();
+    }
+
+    added.clear();
+    rewrite = false;
+}
+
+// ***************************************************************************************************//
+
+List
+ModelStore::convert2list() const
+{
+    return List::create(_["file"] = fileName,
+                        _["nLoaded"] = static_cast<double>(nLoaded),
+                        _["nFound"] = static_cast<double>(nFound),
+                        _["nAdded"] = static_cast<double>(nAdded));
+}
+
+// ***************************************************************************************************//
+
+// End of modelStore.cpp
@@ -0,0 +1,93 @@
+/*
+ * modelStore.h
+ */
+
+#ifndef MODELSTORE_H_
+#define MODELSTORE_H_
+
+#include "mytypes.h"
+#include "rcppExport.h"
+#include "dataStructure.h"
+#include "checkpoint.h"
+#include <string>
+#include <map>
+#include <vector>
+#include <utility>
+
+// ***************************************************************************************************//
+
+// the key of a model search in the model store: a 128 bit hash of the data, the model space
+// and the hyperparameter, computed from the serialized R objects which determine the R^2 values
+typedef std::pair<unsigned long long, unsigned long long> ModelStoreKey;
+
+// Persistent store of the coefficients of determination of the computed models, which is reused
+// across runs. R^2 is the expensive part of a model: the marginal likelihood and the posterior
+// expectations follow from it and the model dimension in closed form, and the prior is cheap.
+// Non-identifiable models are kept with NaN R^2, so that they are not tried again.
+// The records of all model searches sharing the file are kept, each under its key,
+// and looked up for the key of the current search.
+// The file uses the checkpoint file format and consists of blocks of records: flush() appends
+// one block with the models added since the last flush, so the file grows with the new models
+// only. It is read once at construction, decoding all records into the map, so it is not mapped
+// into memory. A last block which a killed session has left incomplete is dropped, and then the
+// next flush rewrites the whole store. Concurrent runs must not share a store file.
+class ModelStore
+{
+public:
+    // empty fileName gives an inactive store which does nothing.
+    // The fingerprint is the serialized R information (a raw vector) from which the key is computed.
+    ModelStore(const std::string& fileName,
+               SEXP fingerprint);
+
+    bool
+    active() const
+    {
+        return ! fileName.empty();
+    }
+
+    // look up the model in the store: if it is there, return true
+    // and fill in R^2 and the number of design matrix columns
+    bool
+    find(const modelPar& par,
+         double& R2,
+         int& dim);
+
+    // add a newly computed model
+    void
+    add(const modelPar& par,
+        double R2,
+        int dim);
+
+    // append the models added since the last flush to the store file
+    void
+    flush();
+
+    // counts of loaded, found and added models, as R list
+    Rcpp::List
+    convert2list() const;
+
+private:
+    typedef std::map<std::pair<ModelStoreKey, modelPar>, std::pair<double, int> > MapType;
+
+    // write one record
+    static void
+    writeRecord(CheckpointWriter& file,
+                const MapType::value_type& r);
+
+    const std::string fileName;
+    const ModelStoreKey key;
+
+    MapType records;
+
+    // the records added since the last flush
+    std::vector<MapType::const_iterator> added;
+
+    // must the whole file be rewritten at the next flush?
+    bool rewrite;
+
+    PosLargeInt nLoaded, nFound, nAdded;
+};
+
+// ***************************************************************************************************//
+
+#endif /* MODELSTORE_H_ */
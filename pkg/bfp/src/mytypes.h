@@ -7,7 +7,7 @@
 #include <string>
 #include <cfloat>
 
-#include "newmat.h"
+#include "rcppExport.h"
 
 // common type defs:
 
@@ -70,8 +70,12 @@ typedef std::set<Index> IndexSet;
 
 
 
+// Armadillo matrix and vector types
+typedef arma::mat AMatrix;
+typedef arma::colvec AVector;
+
 // derivatives from matrix types
-typedef std::vector<std::vector<ColumnVector> > ColumnVectorArray;
+typedef std::vector<std::vector<AVector> > AVectorArray;
 
 
 
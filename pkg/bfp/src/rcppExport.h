@@ -25,7 +25,7 @@ template <typename T> class Exporter<std::set<T> >;
 
 // this must appear after the specialization,
 // otherwise the specialization will not be seen by Rcpp types
-#include <Rcpp.h>
+#include <RcppArmadillo.h>
 
 
 // only now the implementation of the new Exporter class:
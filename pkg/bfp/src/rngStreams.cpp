@@ -0,0 +1,257 @@
+/*
+ * rngStreams.cpp
+ *
+ *  Twin of glmBfp/src/rngStreams.cpp: changes must be made in both files, which only differ
+ *  in the include style and the type names of the two packages (bfp also has the gamma
+ *  and Student t variates for BmaSamples).
+ */
+
+#include "rngStreams.h"
+#include "rcppExport.h"
+#include <cmath>
+
+// ***************************************************************************************************//
+
+// Philox4x32 round multipliers and Weyl key increments
+static const uint32_t philoxM0 = 0xD2511F53;
+static const uint32_t philoxM1 = 0xCD9E8D57;
+static const uint32_t philoxW0 = 0x9E3779B9;
+static const uint32_t philoxW1 = 0xBB67AE85;
+
+// 2^-53 for converting 53 random bits into a double
+static const double twoPowerMinus53 = 1.0 / 9007199254740992.0;
+
+// the splitmix64 finalizer, for deriving the seeds of substreams
+static uint64_t
+mix64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
+RngStream::RngStream() :
+	legacy(true),
+	nBitsUsed(4),
+	hasSpareNormal(false),
+	spareNormal(0.0)
+{
+	key[0] = key[1] = 0;
+	counter[0] = counter[1] = counter[2] = counter[3] = 0;
+}
+
+RngStream::RngStream(uint64_t seed, uint64_t stream) :
+	legacy(false),
+	nBitsUsed(4),
+	hasSpareNormal(false),
+	spareNormal(0.0)
+{
+	key[0] = static_cast<uint32_t>(seed);
+	key[1] = static_cast<uint32_t>(seed >> 32);
+
+	// the lower half of the counter walks through the stream,
+	// the upper half identifies the stream
+	counter[0] = 0;
+	counter[1] = 0;
+	counter[2] = static_cast<uint32_t>(stream);
+	counter[3] = static_cast<uint32_t>(stream >> 32);
+}
+
+RngStream
+RngStream::split(uint64_t index) const
+{
+	if(legacy)
+		return *this;
+
+	// a new key from the current key and stream number, so that
+	// nested splits give independent streams as well
+	const uint64_t seed = (static_cast<uint64_t>(key[1]) << 32) | key[0];
+	const uint64_t stream = (static_cast<uint64_t>(counter[3]) << 32) | counter[2];
+
+	return RngStream(mix64(seed ^ mix64(stream + 0x9E3779B97F4A7C15ULL)), index);
+}
+
+void
+RngStream::refill()
+{
+	uint32_t c[4] = {counter[0], counter[1], counter[2], counter[3]};
+	uint32_t k[2] = {key[0], key[1]};
+
+	for(int round = 0; round < 10; ++round)
+	{
+		const uint64_t p0 = static_cast<uint64_t>(philoxM0) * c[0];
+		const uint64_t p1 = static_cast<uint64_t>(philoxM1) * c[2];
+
+		const uint32_t next[4] = {static_cast<uint32_t>(p1 >> 32) ^ c[1] ^ k[0],
+								  static_cast<uint32_t>(p1),
+								  static_cast<uint32_t>(p0 >> 32) ^ c[3] ^ k[1],
+								  static_cast<uint32_t>(p0)};
+		c[0] = next[0];
+		c[1] = next[1];
+		c[2] = next[2];
+		c[3] = next[3];
+
+		k[0] += philoxW0;
+		k[1] += philoxW1;
+	}
+
+	bits[0] = c[0];
+	bits[1] = c[1];
+	bits[2] = c[2];
+	bits[3] = c[3];
+	nBitsUsed = 0;
+
+	// increment the 64 bit position within the stream
+	if(++counter[0] == 0)
+		++counter[1];
+}
+
+double
+RngStream::unif()
+{
+	if(legacy)
+		return R::unif_rand();
+
+	if(nBitsUsed == 4)
+		refill();
+
+	const uint64_t word = (static_cast<uint64_t>(bits[nBitsUsed]) << 32) | bits[nBitsUsed + 1];
+	nBitsUsed += 2;
+
+	// take the upper 53 bits and shift by one half so that 0 and 1 cannot occur
+	return (static_cast<double>(word >> 11) + 0.5) * twoPowerMinus53;
+}
+
+double
+RngStream::normal()
+{
+	if(legacy)
+		return R::norm_rand();
+
+	if(hasSpareNormal)
+	{
+		hasSpareNormal = false;
+		return spareNormal;
+	}
+
+	const double radius = std::sqrt(-2.0 * std::log(unif()));
+	const double angle = 2.0 * M_PI * unif();
+
+	spareNormal = radius * std::sin(angle);
+	hasSpareNormal = true;
+
+	return radius * std::cos(angle);
+}
+
+double
+RngStream::gamma(double shape, double scale)
+{
+	if(legacy)
+		return R::rgamma(shape, scale);
+
+	// boost shapes below 1
+	if(shape < 1.0)
+		return gamma(shape + 1.0, scale) * std::pow(unif(), 1.0 / shape);
+
+	const double d = shape - 1.0 / 3.0;
+	const double c = 1.0 / std::sqrt(9.0 * d);
+
+	while(true)
+	{
+		const double x = normal();
+		double v = 1.0 + c * x;
+		if(v <= 0.0)
+			continue;
+
+		v = v * v * v;
+		if(std::log(unif()) < 0.5 * x * x + d - d * v + d * std::log(v))
+			return d * v * scale;
+	}
+}
+
+double
+RngStream::studentT(double df)
+{
+	if(legacy)
+		return R::rt(df);
+
+	// a normal divided by the root of an independent chi-square over its degrees of freedom
+	return normal() / std::sqrt(gamma(df / 2.0, 2.0) / df);
+}
+
+void
+RngStream::save(CheckpointWriter& checkpoint) const
+{
+	checkpoint.write(legacy);
+
+	if(legacy)
+	{
+		// the current state of R's generator is in .Random.seed after PutRNGstate()
+		PutRNGstate();
+		Rcpp::IntegerVector seed(Rf_findVarInFrame(R_GlobalEnv, Rf_install(".Random.seed")));
+		checkpoint.write(std::vector<int>(seed.begin(), seed.end()));
+	}
+	else
+	{
+		checkpoint.write(key);
+		checkpoint.write(counter);
+		checkpoint.write(bits);
+		checkpoint.write(nBitsUsed);
+		checkpoint.write(hasSpareNormal);
+		checkpoint.write(spareNormal);
+	}
+}
+
+void
+RngStream::restore(CheckpointReader& checkpoint)
+{
+	checkpoint.read(legacy);
+
+	if(legacy)
+	{
+		std::vector<int> seed;
+		checkpoint.read(seed);
+
+		Rcpp::IntegerVector rSeed(seed.begin(), seed.end());
+		Rf_defineVar(Rf_install(".Random.seed"), rSeed, R_GlobalEnv);
+		GetRNGstate();
+	}
+	else
+	{
+		checkpoint.read(key);
+		checkpoint.read(counter);
+		checkpoint.read(bits);
+		checkpoint.read(nBitsUsed);
+		checkpoint.read(hasSpareNormal);
+		checkpoint.read(spareNormal);
+	}
+}
+
+// ***************************************************************************************************//
+
+uint64_t
+seedFromR()
+{
+	GetRNGstate();
+
+	// two draws give 2 x 32 bits
+	const uint64_t upper = static_cast<uint64_t>(R::unif_rand() * 4294967296.0);
+	const uint64_t lower = static_cast<uint64_t>(R::unif_rand() * 4294967296.0);
+
+	PutRNGstate();
+
+	return (upper << 32) | lower;
+}
+
+RngStream
+getRngStream(bool legacyRng)
+{
+	if(legacyRng)
+		return RngStream();
+	else
+		return RngStream(seedFromR(), 0);
+}
+
+// ***************************************************************************************************//
+
+// End of rngStreams.cpp
@@ -0,0 +1,106 @@
+/*
+ * rngStreams.h
+ *
+ *  Twin of glmBfp/src/rngStreams.h: changes must be made in both files, which only differ
+ *  in the include style and the type names of the two packages (bfp also has the gamma
+ *  and Student t variates for BmaSamples).
+ *
+ *  Random number streams for the samplers.
+ */
+
+#ifndef RNGSTREAMS_H_
+#define RNGSTREAMS_H_
+
+#include <stdint.h>
+#include "checkpoint.h"
+
+// ***************************************************************************************************//
+
+// Random number stream for the samplers.
+// Usually this is a counter-based generator (Philox4x32-10, Salmon et al. 2011):
+// each draw is a pure function of (seed, stream, position), so streams need no shared state
+// and can be used concurrently from OpenMP threads. Work is split by giving each fixed-size
+// block of draws its own substream, so that the result does not depend on the number
+// of threads.
+// The legacy stream instead uses R's global generator, which reproduces the samples of
+// earlier package versions. It must only be used from the master thread, enclosed
+// in GetRNGstate() / PutRNGstate().
+class RngStream
+{
+public:
+	// ctr for the legacy stream
+	RngStream();
+
+	// ctr for a counter-based stream: the seed is usually obtained by seedFromR()
+	// once per call, the stream number identifies the independent substream.
+	RngStream(uint64_t seed, uint64_t stream);
+
+	// get the independent substream with this index. A legacy stream splits into itself,
+	// because R's generator is global.
+	RngStream
+	split(uint64_t index) const;
+
+	// does this stream use R's global generator?
+	bool
+	isLegacy() const
+	{
+		return legacy;
+	}
+
+	// uniform variate on the open interval (0, 1)
+	double
+	unif();
+
+	// standard normal variate (Box-Muller)
+	double
+	normal();
+
+	// gamma variate with given shape and scale (Marsaglia and Tsang 2000)
+	double
+	gamma(double shape, double scale);
+
+	// Student t variate with df degrees of freedom
+	double
+	studentT(double df);
+
+	// save the position of the stream in a checkpoint, and restore it from there.
+	// For the legacy stream this is the state of R's generator, so both must only be
+	// called from the master thread.
+	void
+	save(CheckpointWriter& checkpoint) const;
+
+	void
+	restore(CheckpointReader& checkpoint);
+
+private:
+	// compute the next 4 x 32 random bits for the current counter and increment it
+	void
+	refill();
+
+	bool legacy;
+
+	uint32_t key[2];
+	uint32_t counter[4];
+
+	uint32_t bits[4];
+	unsigned int nBitsUsed;
+
+	bool hasSpareNormal;
+	double spareNormal;
+};
+
+// ***************************************************************************************************//
+
+// draw a 64 bit seed from R's random number generator, so that set.seed() in R
+// makes the streams reproducible. Must be called from the master thread.
+uint64_t
+seedFromR();
+
+// the stream for one call of a sampler: either the legacy stream or
+// the counter-based stream 0 seeded from R.
+RngStream
+getRngStream(bool legacyRng);
+
+// ***************************************************************************************************//
+
+#endif /* RNGSTREAMS_H_ */
@@ -0,0 +1,389 @@
+/*
+ * sufficientStats.cpp
+ */
+
+#include "sufficientStats.h"
+#include "linalgInterface.h"
+#include "rcppExport.h"
+#include "conversions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::vector;
+
+// ***************************************************************************************************//
+
+// twin of glmBfp/src/columnFile.cpp: changes must be made in both files
+ColumnFile::ColumnFile(const std::string& fileName) :
+    fileName(fileName),
+    nrow(0),
+    names(),
+    dataOffset(0),
+    map(0),
+    mapLength(0)
+{
+    std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+    if(! stream)
+        Rcpp::stop("cannot open column file " + fileName);
+
+    char magic[8];
+    double header[3];
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(header), sizeof(header));
+    if(! stream || (std::memcmp(magic, "BFPCOLS1", sizeof(magic)) != 0))
+        Rcpp::stop(fileName + " is not a column file");
+
+    nrow = static_cast<R_xlen_t>(header[0]);
+    const PosInt ncol = static_cast<PosInt>(header[1]);
+    const long long namesLength = static_cast<long long>(header[2]);
+
+    // the names block
+    vector<char> block(namesLength + 1, '\0');
+    stream.read(&block[0], namesLength);
+    for(long long start = 0; (start < namesLength) && (names.size() < ncol); )
+    {
+        const std::string name(&block[start]);
+        names.push_back(name);
+        start += name.size() + 1;
+    }
+
+    dataOffset = sizeof(magic) + sizeof(header) + namesLength;
+
+    // the file must contain all columns
+    stream.seekg(0, std::ios::end);
+    const long long fileSize = stream.tellg();
+    if(! stream || (names.size() != ncol) ||
+       (fileSize != dataOffset + static_cast<long long>(sizeof(double)) * nrow * ncol))
+        Rcpp::stop("column file " + fileName + " is truncated or corrupt");
+
+#ifndef _WIN32
+    // map the whole file: the operating system then pages the columns in and out as needed
+    const int fd = open(fileName.c_str(), O_RDONLY);
+    if(fd != -1)
+    {
+        void* address = mmap(0, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if(address != MAP_FAILED)
+        {
+            map = static_cast<const char*>(address);
+            mapLength = fileSize;
+        }
+    }
+#endif
+}
+
+ColumnFile::~ColumnFile()
+{
+#ifndef _WIN32
+    if(map)
+        munmap(const_cast<char*>(map), mapLength);
+#endif
+}
+
+void
+ColumnFile::read(PosInt col,
+                 R_xlen_t first,
+                 R_xlen_t n,
+                 double* out) const
+{
+    if((col >= nCols()) || (first < 0) || (n < 0) || (first + n > nrow))
+        Rcpp::stop("invalid rows or column requested from column file " + fileName);
+
+    const long long offset = dataOffset + static_cast<long long>(sizeof(double)) * (col * nrow + first);
+
+    if(map)
+    {
+        std::memcpy(out, map + offset, sizeof(double) * n);
+    }
+    else
+    {
+        std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+        stream.seekg(offset);
+        stream.read(reinterpret_cast<char*>(out), sizeof(double) * n);
+        if(! stream)
+            Rcpp::stop("could not read column file " + fileName);
+    }
+}
+
+// ***************************************************************************************************//
+
+SufficientStats::SufficientStats(SEXP R_stats) :
+    nObs(0),
+    means(),
+    gram(),
+    fpStart(),
+    fpcards(),
+    designIndex(),
+    powerset()
+{
+    if(Rf_isNull(R_stats))
+        return;
+
+    Rcpp::List stats(R_stats);
+    nObs = static_cast<R_xlen_t>(Rcpp::as<double>(stats["nObs"]));
+    means = Rcpp::as<AVector>(stats["means"]);
+    gram = Rcpp::as<AMatrix>(stats["gram"]);
+    fpStart = Rcpp::as<IntVector>(stats["fpStart"]);
+    fpcards = Rcpp::as<IntVector>(stats["fpcards"]);
+    designIndex = Rcpp::as<IntVector>(stats["designIndex"]);
+    powerset = Rcpp::as<DoubleVector>(stats["powerset"]);
+}
+
+SufficientStats::SufficientStats(const ColumnFile& file,
+                                 const IntVector& fileCols,
+                                 int responseCol,
+                                 const IntVector& fppos,
+                                 const IntVector& fpmaxs,
+                                 const IntVector& fpcards,
+                                 const DoubleVector& shifts,
+                                 const DoubleVector& scales,
+                                 R_xlen_t chunkSize) :
+    nObs(0),
+    means(),
+    gram(),
+    fpStart(),
+    fpcards(fpcards),
+    designIndex(fileCols.size(), -1),
+    powerset(getPowerset(fpmaxs.empty() ? 0 : *std::max_element(fpmaxs.begin(), fpmaxs.end())))
+{
+    // the candidate columns: first the FP basis columns,
+    int nCandidates = 0;
+    vector<bool> isFp(fileCols.size(), false);
+    for(IntVector::size_type i = 0; i != fppos.size(); ++i)
+    {
+        fpStart.push_back(nCandidates);
+        nCandidates += fpcards[i] * fpmaxs[i];
+        isFp.at(fppos[i] - 1) = true;
+    }
+
+    // then the other non-intercept design matrix columns
+    const int nFpCandidates = nCandidates;
+    IntVector otherFileCols;
+    for(IntVector::size_type j = 0; j != fileCols.size(); ++j)
+    {
+        if((fileCols[j] != 0) && ! isFp[j])
+        {
+            designIndex[j] = nCandidates++;
+            otherFileCols.push_back(fileCols[j]);
+        }
+    }
+
+    // and the response
+    const PosInt nCols = nCandidates + 1;
+    means.zeros(nCols);
+    gram.zeros(nCols, nCols);
+
+    AMatrix chunk;
+    AVector raw;
+    for(R_xlen_t first = 0; first < file.nRows(); first += chunkSize)
+    {
+        const R_xlen_t m = std::min(chunkSize, file.nRows() - first);
+        chunk.set_size(m, nCols);
+        raw.set_size(m);
+
+        // the FP basis columns, computed as in the fpInfo constructor, but not centered
+        for(IntVector::size_type i = 0; i != fppos.size(); ++i)
+        {
+            file.read(fileCols.at(fppos[i] - 1) - 1, first, m, raw.memptr());
+            raw = (raw + shifts[i]) / scales[i];
+            if(! raw.is_finite() || (raw.min() <= 0))
+                Rcpp::stop("FP covariates must be finite and positive after the prescaling");
+
+            const AVector logCol = arma::log(raw);
+            for(int j = 0; j != fpcards[i]; ++j)
+            {
+                const double thisPower = powerset.at(j);
+                AVector thisLevel = thisPower ? AVector(arma::pow(raw, thisPower)) : logCol;
+                for(int repeat = 0; repeat != fpmaxs[i]; ++repeat)
+                {
+                    if(repeat > 0)
+                        thisLevel %= logCol;
+                    chunk.col(fpColumn(i, j, repeat)) = thisLevel;
+                }
+            }
+        }
+
+        // the other columns and the response
+        for(IntVector::size_type k = 0; k != otherFileCols.size(); ++k)
+        {
+            file.read(otherFileCols[k] - 1, first, m, chunk.colptr(nFpCandidates + k));
+        }
+        file.read(responseCol - 1, first, m, chunk.colptr(nCols - 1));
+
+        if(! chunk.is_finite())
+            Rcpp::stop("the column file must not contain missing or non-finite values");
+
+        // merge the centered crossproduct of the chunk into the statistics,
+        // so that large sums of squares never need to be subtracted
+        const AVector chunkMeans = arma::trans(arma::mean(chunk, 0));
+        chunk.each_row() -= arma::trans(chunkMeans);
+
+        AMatrix chunkGram = arma::zeros<AMatrix>(nCols, nCols);
+        syrk(false, true, chunk, 0.0, chunkGram);
+
+        const AVector delta = chunkMeans - means;
+        const double total = static_cast<double>(nObs) + m;
+        gram += arma::trimatl(chunkGram) + (static_cast<double>(nObs) * m / total) * (delta * arma::trans(delta));
+        means += (m / total) * delta;
+        nObs += m;
+
+        R_CheckUserInterrupt();
+    }
+
+    gram = arma::symmatl(gram);
+}
+
+// ***************************************************************************************************//
+
+arma::uvec
+SufficientStats::getColumns(const modelPar& mod,
+                            const fpInfo& currFp,
+                            const vector<IntSet>& ucTermList) const
+{
+    vector<arma::uword> cols;
+
+    // the FP columns, with the repeat levels counted as in gatherFpColumns
+    for(PosInt i = 0; i != currFp.nFps; ++i)
+    {
+        const Powers& powersi = mod.fpPars.at(i);
+
+        int lastInd = -1;
+        int repeat = 0;
+        for(Powers::const_iterator now = powersi.begin(); now != powersi.end(); ++now)
+        {
+            repeat = (*now == lastInd) ? repeat + 1 : 0;
+            lastInd = *now;
+            cols.push_back(fpColumn(i, lastInd, repeat));
+        }
+    }
+
+    // the UC columns
+    for(IntSet::const_iterator g = mod.ucPars.begin(); g != mod.ucPars.end(); ++g)
+    {
+        const IntSet& thisColList = ucTermList.at(*g - 1);
+        for(IntSet::const_iterator c = thisColList.begin(); c != thisColList.end(); ++c)
+        {
+            cols.push_back(designColumn(*c));
+        }
+    }
+
+    return arma::conv_to<arma::uvec>::from(cols);
+}
+
+double
+SufficientStats::R2(const modelPar& mod,
+                    const fpInfo& currFp,
+                    const vector<IntSet>& ucTermList,
+                    const hyperPriorPars& hyp,
+                    int& dim) const
+{
+    const arma::uvec cols = getColumns(mod, currFp, ucTermList);
+
+    dim = 1 + cols.n_elem;
+    if(dim - 1 >= nObs - 3 - hyp.a)
+        return R_NaN; // not a valid model
+
+    if(cols.is_empty())
+        return 0; // the null model
+
+    // the cholesky factor of X'X: if X'X is not p.d. then return NaN
+    AMatrix XtX = gram.submat(cols, cols);
+    if(potrf(false, XtX) != 0)
+        return R_NaN;
+
+    // solve L * tmp = X' * y
+    AMatrix tmp = gram.submat(cols, responseIndex());
+    trs(false, false, XtX, tmp);
+
+    return arma::accu(arma::square(tmp)) / sumOfSquaresTotal();
+}
+
+// ***************************************************************************************************//
+
+SEXP
+SufficientStats::convert2list() const
+{
+    return Rcpp::List::create(Rcpp::_["nObs"] = static_cast<double>(nObs),
+                              Rcpp::_["means"] = Rcpp::NumericVector(means.begin(), means.end()),
+                              Rcpp::_["gram"] = Rcpp::wrap(gram),
+                              Rcpp::_["fpStart"] = Rcpp::wrap(fpStart),
+                              Rcpp::_["fpcards"] = Rcpp::wrap(fpcards),
+                              Rcpp::_["designIndex"] = Rcpp::wrap(designIndex),
+                              Rcpp::_["powerset"] = Rcpp::wrap(powerset));
+}
+
+// ***************************************************************************************************//
+
+SEXP
+columnFileInfo(SEXP R_file) // the column file name
+{
+    BEGIN_RCPP
+    const ColumnFile file(getStringVector(R_file).at(0));
+
+    return Rcpp::List::create(Rcpp::_["nrow"] = static_cast<double>(file.nRows()),
+                              Rcpp::_["names"] = Rcpp::wrap(file.getNames()));
+    END_RCPP
+}
+
+SEXP
+columnFileRead(SEXP R_file, // the column file name
+               SEXP R_columns, // the (1-based) columns to read
+               SEXP R_first, // the first (1-based) row to read
+               SEXP R_n) // the number of rows to read
+{
+    BEGIN_RCPP
+    const ColumnFile file(getStringVector(R_file).at(0));
+    const IntVector columns = getIntegerVector(R_columns);
+    const R_xlen_t first = static_cast<R_xlen_t>(Rf_asReal(R_first)) - 1;
+    const R_xlen_t n = static_cast<R_xlen_t>(Rf_asReal(R_n));
+
+    Rcpp::NumericMatrix ret(n, columns.size());
+    for(IntVector::size_type j = 0; j != columns.size(); ++j)
+    {
+        file.read(columns[j] - 1, first, n, &ret(0, j));
+    }
+
+    return ret;
+    END_RCPP
+}
+
+SEXP
+columnFileStats(SEXP R_file, // the column file name
+                SEXP R_fileCols, // for each design matrix column its file column, 0 for the intercept
+                SEXP R_responseCol, // the file column of the response
+                SEXP R_fppos, // the design matrix columns of the FPs
+                SEXP R_fpmaxs, // vector of maximum fp degrees
+                SEXP R_fpcards, // corresponding vector of power set cardinalities
+                SEXP R_shifts, // the prescaling shifts of the FPs
+                SEXP R_scales, // and their scales
+                SEXP R_chunkSize) // how many rows are processed at once?
+{
+    BEGIN_RCPP
+    const ColumnFile file(getStringVector(R_file).at(0));
+
+    const SufficientStats stats(file,
+                                getIntegerVector(R_fileCols),
+                                Rf_asInteger(R_responseCol),
+                                getIntegerVector(R_fppos),
+                                getIntegerVector(R_fpmaxs),
+                                getIntegerVector(R_fpcards),
+                                getDoubleVector(R_shifts),
+                                getDoubleVector(R_scales),
+                                static_cast<R_xlen_t>(Rf_asReal(R_chunkSize)));
+
+    return stats.convert2list();
+    END_RCPP
+}
+
+// End of sufficientStats.cpp
@@ -0,0 +1,174 @@
+/*
+ * sufficientStats.h
+ *
+ *  Out-of-core data mode: the raw covariates live in a column file, which is memory-mapped,
+ *  and the model search only needs the sufficient statistics of the Gaussian model, which are
+ *  accumulated in streaming chunks of rows.
+ */
+
+#ifndef SUFFICIENTSTATS_H_
+#define SUFFICIENTSTATS_H_
+
+#include "dataStructure.h"
+#include "mytypes.h"
+
+#include <string>
+#include <vector>
+
+// Read-only access to a column file. The file format is (all numbers in native byte order):
+// - the 8 bytes "BFPCOLS1",
+// - the number of rows, the number of columns and the length of the names block, as doubles,
+// - the names block: the column names as null-terminated strings, padded with zero bytes
+//   to a multiple of 8 bytes,
+// - the columns one after the other, each as doubles.
+// Where possible the file is memory-mapped, otherwise the requested rows are read from it.
+// Twin of glmBfp/src/columnFile.h: changes must be made in both files.
+class ColumnFile
+{
+public:
+    explicit
+    ColumnFile(const std::string& fileName);
+
+    ~ColumnFile();
+
+    R_xlen_t
+    nRows() const
+    {
+        return nrow;
+    }
+
+    PosInt
+    nCols() const
+    {
+        return names.size();
+    }
+
+    const StringVector&
+    getNames() const
+    {
+        return names;
+    }
+
+    // copy the rows first, ..., first + n - 1 of column col (0-based) into out
+    void
+    read(PosInt col,
+         R_xlen_t first,
+         R_xlen_t n,
+         double* out) const;
+
+private:
+    // not copyable
+    ColumnFile(const ColumnFile&);
+    ColumnFile& operator=(const ColumnFile&);
+
+    const std::string fileName;
+    R_xlen_t nrow;
+    StringVector names;
+
+    // the byte offset of the first column
+    long long dataOffset;
+
+    // the mapping of the whole file (0 if the file is not mapped)
+    const char* map;
+    size_t mapLength;
+};
+
+// ***************************************************************************************************//
+
+// The sufficient statistics of the Gaussian model search: the number of observations, and the
+// means and the centered crossproduct (Gram) matrix of all candidate columns and the response.
+// The candidate columns are the FP basis columns of all powers and repeat levels (as in fpInfo),
+// followed by the other non-intercept design matrix columns. The response is the last column.
+class SufficientStats
+{
+public:
+    // from the R list, or inactive for R's NULL
+    explicit
+    SufficientStats(SEXP R_stats);
+
+    // accumulate the statistics from the column file in chunks of chunkSize rows
+    SufficientStats(const ColumnFile& file,
+                    const IntVector& fileCols, // for each design matrix column: its file column
+                                               // (1-based), or 0 for the intercept
+                    int responseCol, // the file column of the response (1-based)
+                    const IntVector& fppos, // the design matrix columns of the FPs (1-based)
+                    const IntVector& fpmaxs,
+                    const IntVector& fpcards,
+                    const DoubleVector& shifts, // the prescaling shifts and scales of the FPs
+                    const DoubleVector& scales,
+                    R_xlen_t chunkSize);
+
+    bool
+    active() const
+    {
+        return nObs > 0;
+    }
+
+    double
+    sumOfSquaresTotal() const
+    {
+        return gram(gram.n_rows - 1, gram.n_cols - 1);
+    }
+
+    // compute the R2 of the model and the dimension of its design matrix,
+    // with the same checks as getR2
+    double
+    R2(const modelPar& mod,
+       const fpInfo& currFp,
+       const std::vector<IntSet>& ucTermList,
+       const hyperPriorPars& hyp,
+       int& dim) const;
+
+    // the candidate columns of the non-intercept design matrix columns of the model
+    arma::uvec
+    getColumns(const modelPar& mod,
+               const fpInfo& currFp,
+               const std::vector<IntSet>& ucTermList) const;
+
+    // the candidate column of the FP basis column for the power index and repeat level
+    arma::uword
+    fpColumn(PosInt fp,
+             int powerInd,
+             int repeat) const
+    {
+        return fpStart.at(fp) + repeat * fpcards.at(fp) + powerInd;
+    }
+
+    // the candidate column of a (1-based) design matrix column which is no FP
+    arma::uword
+    designColumn(int col) const
+    {
+        return designIndex.at(col - 1);
+    }
+
+    // the index of the response
+    arma::uword
+    responseColumn() const
+    {
+        return gram.n_rows - 1;
+    }
+
+    // the same as an index vector for submatrix views
+    arma::uvec
+    responseIndex() const
+    {
+        arma::uvec ret(1);
+        ret(0) = responseColumn();
+        return ret;
+    }
+
+    SEXP
+    convert2list() const;
+
+    R_xlen_t nObs;
+    AVector means;
+    AMatrix gram;
+
+private:
+    IntVector fpStart;
+    IntVector fpcards;
+    IntVector designIndex;
+    DoubleVector powerset;
+};
+
+#endif /* SUFFICIENTSTATS_H_ */
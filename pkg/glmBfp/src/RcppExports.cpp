@@ -22,6 +22,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_columnFileInfo
+SEXP cpp_columnFileInfo(SEXP R_file);
+RcppExport SEXP _glmBfp_cpp_columnFileInfo(SEXP R_fileSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type R_file(R_fileSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_columnFileInfo(R_file));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_coxfit
 SEXP cpp_coxfit(SEXP R_survTimes, SEXP R_censInd, SEXP R_offsets, SEXP R_X, SEXP R_method);
 RcppExport SEXP _glmBfp_cpp_coxfit(SEXP R_survTimesSEXP, SEXP R_censIndSEXP, SEXP R_offsetsSEXP, SEXP R_XSEXP, SEXP R_methodSEXP) {
@@ -37,6 +48,31 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_empiricalHpds
+NumericMatrix cpp_empiricalHpds(NumericMatrix samples, double level);
+RcppExport SEXP _glmBfp_cpp_empiricalHpds(SEXP samplesSEXP, SEXP levelSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericMatrix >::type samples(samplesSEXP);
+    Rcpp::traits::input_parameter< double >::type level(levelSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_empiricalHpds(samples, level));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_scrHpd
+NumericMatrix cpp_scrHpd(NumericMatrix samples, NumericVector mode, double level);
+RcppExport SEXP _glmBfp_cpp_scrHpd(SEXP samplesSEXP, SEXP modeSEXP, SEXP levelSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericMatrix >::type samples(samplesSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type mode(modeSEXP);
+    Rcpp::traits::input_parameter< double >::type level(levelSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_scrHpd(samples, mode, level));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cpp_evalZdensity
 SEXP cpp_evalZdensity(List rcpp_config, List rcpp_data, List rcpp_fpInfos, List rcpp_ucInfos, List rcpp_fixInfos, List rcpp_distribution, List rcpp_options);
 RcppExport SEXP _glmBfp_cpp_evalZdensity(SEXP rcpp_configSEXP, SEXP rcpp_dataSEXP, SEXP rcpp_fpInfosSEXP, SEXP rcpp_ucInfosSEXP, SEXP rcpp_fixInfosSEXP, SEXP rcpp_distributionSEXP, SEXP rcpp_optionsSEXP) {
@@ -72,8 +108,8 @@ BEGIN_RCPP
 END_RCPP
 }
 // cpp_optimize
-SEXP cpp_optimize(SEXP R_function, SEXP R_minx, SEXP R_maxx, SEXP R_precision);
-RcppExport SEXP _glmBfp_cpp_optimize(SEXP R_functionSEXP, SEXP R_minxSEXP, SEXP R_maxxSEXP, SEXP R_precisionSEXP) {
+SEXP cpp_optimize(SEXP R_function, SEXP R_minx, SEXP R_maxx, SEXP R_precision, SEXP R_accurate);
+RcppExport SEXP _glmBfp_cpp_optimize(SEXP R_functionSEXP, SEXP R_minxSEXP, SEXP R_maxxSEXP, SEXP R_precisionSEXP, SEXP R_accurateSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -81,7 +117,8 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< SEXP >::type R_minx(R_minxSEXP);
     Rcpp::traits::input_parameter< SEXP >::type R_maxx(R_maxxSEXP);
     Rcpp::traits::input_parameter< SEXP >::type R_precision(R_precisionSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_optimize(R_function, R_minx, R_maxx, R_precision));
+    Rcpp::traits::input_parameter< SEXP >::type R_accurate(R_accurateSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_optimize(R_function, R_minx, R_maxx, R_precision, R_accurate));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -117,3 +154,30 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// cpp_streamGlm
+SEXP cpp_streamGlm(SEXP R_file, SEXP R_columns, SEXP R_family, SEXP R_options);
+RcppExport SEXP _glmBfp_cpp_streamGlm(SEXP R_fileSEXP, SEXP R_columnsSEXP, SEXP R_familySEXP, SEXP R_optionsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type R_file(R_fileSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type R_columns(R_columnsSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type R_family(R_familySEXP);
+    Rcpp::traits::input_parameter< SEXP >::type R_options(R_optionsSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_streamGlm(R_file, R_columns, R_family, R_options));
+    return rcpp_result_gen;
+END_RCPP
+}
+// cpp_streamCox
+SEXP cpp_streamCox(SEXP R_file, SEXP R_columns, SEXP R_options);
+RcppExport SEXP _glmBfp_cpp_streamCox(SEXP R_fileSEXP, SEXP R_columnsSEXP, SEXP R_optionsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type R_file(R_fileSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type R_columns(R_columnsSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type R_options(R_optionsSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_streamCox(R_file, R_columns, R_options));
+    return rcpp_result_gen;
+END_RCPP
+}
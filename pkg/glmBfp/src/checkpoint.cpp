@@ -0,0 +1,116 @@
+/*
+ * checkpoint.cpp
+ *
+ *  Twin of bfp/src/checkpoint.cpp: changes must be made in both files, which only differ
+ *  in the include style and the type names of the two packages.
+ */
+
+#include <checkpoint.h>
+#include <rcppExport.h>
+#include <cstdio>
+
+// ***************************************************************************************************//
+
+// the format tag at the start of each file of this kind, including the format version
+static std::string
+formatTag(const std::string& kind)
+{
+    return "glmBfp " + kind + " 1";
+}
+
+// ***************************************************************************************************//
+
+CheckpointWriter::CheckpointWriter(const std::string& fileName,
+                                   const MyDoubleVector& fingerprint,
+                                   const std::string& kind,
+                                   bool append) :
+    fileName(fileName),
+    tmpFileName(append ? fileName : fileName + ".tmp"),
+    kind(kind),
+    append(append),
+    stream(tmpFileName.c_str(),
+           append ?
+                   (std::ios::out | std::ios::binary | std::ios::app) :
+                   (std::ios::out | std::ios::binary | std::ios::trunc))
+{
+    if(! stream)
+    {
+        Rcpp::stop("cannot open " + kind + " file " + tmpFileName + " for writing");
+    }
+
+    // the appended values continue the existing file after its header
+    if(append)
+        return;
+
+    // including the terminating null character
+    const std::string tag = formatTag(kind);
+    stream.write(tag.c_str(), tag.size() + 1);
+    write(fingerprint);
+}
+
+void
+CheckpointWriter::commit()
+{
+    stream.close();
+    if(stream.fail())
+    {
+        Rcpp::stop("could not write " + kind + " file " + tmpFileName);
+    }
+
+    if(append)
+        return;
+
+#ifdef _WIN32
+    // rename does not overwrite existing files on Windows
+    std::remove(fileName.c_str());
+#endif
+
+    if(std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+    {
+        Rcpp::stop("could not move " + tmpFileName + " to " + kind + " file " + fileName);
+    }
+}
+
+// ***************************************************************************************************//
+
+CheckpointReader::CheckpointReader(const std::string& fileName,
+                                   const MyDoubleVector& fingerprint,
+                                   const std::string& kind) :
+    fileName(fileName),
+    kind(kind),
+    stream(fileName.c_str(), std::ios::in | std::ios::binary)
+{
+    if(! stream)
+    {
+        Rcpp::stop("cannot open " + kind + " file " + fileName + " for reading");
+    }
+
+    const std::string expectedTag = formatTag(kind);
+    std::vector<char> tag(expectedTag.size() + 1);
+    stream.read(&tag[0], tag.size());
+    if(stream.fail() || (std::string(&tag[0], tag.size()) != std::string(expectedTag.c_str(), tag.size())))
+    {
+        Rcpp::stop(fileName + " is not a " + kind + " file of this package version");
+    }
+
+    MyDoubleVector savedFingerprint;
+    read(savedFingerprint);
+    if(savedFingerprint != fingerprint)
+    {
+        Rcpp::stop(kind + " file " + fileName + " belongs to another model search "
+                   "(different data, model space, prior or sampler options)");
+    }
+}
+
+void
+CheckpointReader::check() const
+{
+    if(stream.fail())
+    {
+        Rcpp::stop(kind + " file " + fileName + " is truncated or corrupt");
+    }
+}
+
+// ***************************************************************************************************//
+
+// End of checkpoint.cpp
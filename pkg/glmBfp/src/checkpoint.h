@@ -0,0 +1,209 @@
+/*
+ * checkpoint.h
+ *
+ *  Twin of bfp/src/checkpoint.h: changes must be made in both files, which only differ
+ *  in the include style and the type names of the two packages.
+ */
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include <types.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <set>
+
+// ***************************************************************************************************//
+
+// where and how often the model sampler writes checkpoints of its state,
+// and whether it resumes from the checkpoint file.
+struct CheckpointOptions
+{
+    CheckpointOptions(const std::string& fileName,
+                      PosLargeInt interval,
+                      bool resume) :
+                          fileName(fileName),
+                          interval(interval),
+                          resume(resume)
+    {
+    }
+
+    // no checkpoints at all?
+    bool
+    active() const
+    {
+        return ! fileName.empty();
+    }
+
+    // empty if no checkpoints shall be written
+    const std::string fileName;
+
+    // number of iterations between two checkpoints
+    const PosLargeInt interval;
+
+    const bool resume;
+};
+
+// ***************************************************************************************************//
+
+// Binary checkpoint file writer.
+// The file starts with a format tag and the fingerprint of the model search, which
+// must be matched when resuming. Then the state of the sampler follows.
+// The same format is used for other binary files of the package, e.g. the model store,
+// which are distinguished by the kind in the format tag.
+// Everything is written into a temporary file first, which replaces the checkpoint
+// file only when commit() is called, so that a killed session always leaves the last
+// complete checkpoint behind. In the append mode, the values are instead appended directly
+// to the existing file, after its format tag and fingerprint, and commit() only closes it.
+// The values are written in the native binary format, so a checkpoint can only be read
+// on the same platform.
+class CheckpointWriter
+{
+public:
+    CheckpointWriter(const std::string& fileName,
+                     const MyDoubleVector& fingerprint,
+                     const std::string& kind = "checkpoint",
+                     bool append = false);
+
+    // a plain value
+    template<class T>
+    void
+    write(const T& x)
+    {
+        stream.write(reinterpret_cast<const char*>(&x), sizeof(T));
+    }
+
+    // STL containers, written as size followed by the elements
+    template<class T>
+    void
+    write(const std::vector<T>& x)
+    {
+        writeContainer(x);
+    }
+
+    template<class T>
+    void
+    write(const std::set<T>& x)
+    {
+        writeContainer(x);
+    }
+
+    template<class T>
+    void
+    write(const std::multiset<T>& x)
+    {
+        writeContainer(x);
+    }
+
+    // close the temporary file and move it to the checkpoint file
+    void
+    commit();
+
+private:
+    template<class C>
+    void
+    writeContainer(const C& container)
+    {
+        write(static_cast<PosLargeInt>(container.size()));
+        for(typename C::const_iterator i = container.begin(); i != container.end(); ++i)
+        {
+            write(*i);
+        }
+    }
+
+    const std::string fileName;
+    const std::string tmpFileName;
+    const std::string kind;
+    const bool append;
+    std::ofstream stream;
+};
+
+// ***************************************************************************************************//
+
+// Binary checkpoint file reader, the counterpart to CheckpointWriter.
+// Stops with an error if the file cannot be read, is truncated or belongs
+// to another model search than the one with this fingerprint.
+class CheckpointReader
+{
+public:
+    CheckpointReader(const std::string& fileName,
+                     const MyDoubleVector& fingerprint,
+                     const std::string& kind = "checkpoint");
+
+    // a plain value
+    template<class T>
+    void
+    read(T& x)
+    {
+        stream.read(reinterpret_cast<char*>(&x), sizeof(T));
+        check();
+    }
+
+    // STL containers
+    template<class T>
+    void
+    read(std::vector<T>& x)
+    {
+        x.resize(readSize());
+        for(typename std::vector<T>::iterator i = x.begin(); i != x.end(); ++i)
+        {
+            read(*i);
+        }
+    }
+
+    template<class T>
+    void
+    read(std::set<T>& x)
+    {
+        readSet(x);
+    }
+
+    template<class T>
+    void
+    read(std::multiset<T>& x)
+    {
+        readSet(x);
+    }
+
+    // has the whole file been read?
+    bool
+    atEnd()
+    {
+        return stream.peek() == std::char_traits<char>::eof();
+    }
+
+private:
+    template<class C>
+    void
+    readSet(C& container)
+    {
+        container.clear();
+        for(PosLargeInt n = readSize(); n != 0; --n)
+        {
+            typename C::value_type element;
+            read(element);
+            container.insert(container.end(), element);
+        }
+    }
+
+    PosLargeInt
+    readSize()
+    {
+        PosLargeInt size;
+        read(size);
+        return size;
+    }
+
+    // stop if the last read failed
+    void
+    check() const;
+
+    const std::string fileName;
+    const std::string kind;
+    std::ifstream stream;
+};
+
+// ***************************************************************************************************//
+
+#endif /* CHECKPOINT_H_ */
@@ -0,0 +1,129 @@
+/*
+ * columnFile.cpp
+ *
+ *  Twin of the class ColumnFile in bfp/src/sufficientStats.cpp: changes must be made in both
+ *  files, which only differ in the include style and the type names of the two packages.
+ */
+
+#include <columnFile.h>
+#include <rcppExport.h>
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Rcpp;
+
+// ***************************************************************************************************//
+
+ColumnFile::ColumnFile(const std::string& fileName) :
+    fileName(fileName),
+    nrow(0),
+    names(),
+    dataOffset(0),
+    map(0),
+    mapLength(0)
+{
+    std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+    if(! stream)
+        Rcpp::stop("cannot open column file " + fileName);
+
+    char magic[8];
+    double header[3];
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(header), sizeof(header));
+    if(! stream || (std::memcmp(magic, "BFPCOLS1", sizeof(magic)) != 0))
+        Rcpp::stop(fileName + " is not a column file");
+
+    nrow = static_cast<R_xlen_t>(header[0]);
+    const PosInt ncol = static_cast<PosInt>(header[1]);
+    const long long namesLength = static_cast<long long>(header[2]);
+
+    // the names block
+    std::vector<char> block(namesLength + 1, '\0');
+    stream.read(&block[0], namesLength);
+    for(long long start = 0; (start < namesLength) && (names.size() < ncol); )
+    {
+        const std::string name(&block[start]);
+        names.push_back(name);
+        start += name.size() + 1;
+    }
+
+    dataOffset = sizeof(magic) + sizeof(header) + namesLength;
+
+    // the file must contain all columns
+    stream.seekg(0, std::ios::end);
+    const long long fileSize = stream.tellg();
+    if(! stream || (names.size() != ncol) ||
+       (fileSize != dataOffset + static_cast<long long>(sizeof(double)) * nrow * ncol))
+        Rcpp::stop("column file " + fileName + " is truncated or corrupt");
+
+#ifndef _WIN32
+    // map the whole file: the operating system then pages the columns in and out as needed
+    const int fd = open(fileName.c_str(), O_RDONLY);
+    if(fd != -1)
+    {
+        void* address = mmap(0, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if(address != MAP_FAILED)
+        {
+            map = static_cast<const char*>(address);
+            mapLength = fileSize;
+        }
+    }
+#endif
+}
+
+ColumnFile::~ColumnFile()
+{
+#ifndef _WIN32
+    if(map)
+        munmap(const_cast<char*>(map), mapLength);
+#endif
+}
+
+void
+ColumnFile::read(PosInt col,
+                 R_xlen_t first,
+                 R_xlen_t n,
+                 double* out) const
+{
+    if((col >= nCols()) || (first < 0) || (n < 0) || (first + n > nrow))
+        Rcpp::stop("invalid rows or column requested from column file " + fileName);
+
+    const long long offset = dataOffset + static_cast<long long>(sizeof(double)) * (col * nrow + first);
+
+    if(map)
+    {
+        std::memcpy(out, map + offset, sizeof(double) * n);
+    }
+    else
+    {
+        std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+        stream.seekg(offset);
+        stream.read(reinterpret_cast<char*>(out), sizeof(double) * n);
+        if(! stream)
+            Rcpp::stop("could not read column file " + fileName);
+    }
+}
+
+// ***************************************************************************************************//
+
+// the number of rows and the column names of a column file
+// [[Rcpp::export]]
+SEXP
+cpp_columnFileInfo(SEXP R_file)
+{
+    const ColumnFile file(as<std::string>(R_file));
+
+    return List::create(_["nrow"] = static_cast<double>(file.nRows()),
+                        _["names"] = wrap(file.getNames()));
+}
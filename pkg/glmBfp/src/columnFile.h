@@ -0,0 +1,71 @@
+/*
+ * columnFile.h
+ *
+ *  Twin of the class ColumnFile in bfp/src/sufficientStats.h: changes must be made in both
+ *  files, which only differ in the include style and the type names of the two packages.
+ */
+
+#ifndef COLUMNFILE_H_
+#define COLUMNFILE_H_
+
+#include <types.h>
+#include <string>
+
+// Read-only access to a column file. The file format is (all numbers in native byte order):
+// - the 8 bytes "BFPCOLS1",
+// - the number of rows, the number of columns and the length of the names block, as doubles,
+// - the names block: the column names as null-terminated strings, padded with zero bytes
+//   to a multiple of 8 bytes,
+// - the columns one after the other, each as doubles.
+// Where possible the file is memory-mapped, otherwise the requested rows are read from it.
+class ColumnFile
+{
+public:
+    explicit
+    ColumnFile(const std::string& fileName);
+
+    ~ColumnFile();
+
+    R_xlen_t
+    nRows() const
+    {
+        return nrow;
+    }
+
+    PosInt
+    nCols() const
+    {
+        return names.size();
+    }
+
+    const StrVector&
+    getNames() const
+    {
+        return names;
+    }
+
+    // copy the rows first, ..., first + n - 1 of column col (0-based) into out
+    void
+    read(PosInt col,
+         R_xlen_t first,
+         R_xlen_t n,
+         double* out) const;
+
+private:
+    // not copyable
+    ColumnFile(const ColumnFile&);
+    ColumnFile& operator=(const ColumnFile&);
+
+    const std::string fileName;
+    R_xlen_t nrow;
+    StrVector names;
+
+    // the byte offset of the first column
+    long long dataOffset;
+
+    // the mapping of the whole file (0 if the file is not mapped)
+    const char* map;
+    size_t mapLength;
+};
+
+#endif /* COLUMNFILE_H_ */
@@ -14,6 +14,7 @@
 #include <rcppExport.h>
 #include <types.h>
 #include <coxfit.h>
+#include <memoryUsage.h>
 
 using namespace Rcpp;
 
@@ -715,11 +716,7 @@ cpp_coxfit(SEXP R_survTimes, SEXP R_censInd, SEXP R_offsets, SEXP R_X, SEXP R_me
 
     // survival times
     const NumericVector n_survTimes = R_survTimes;
-    //const AVector survTimes(n_survTimes.begin(), n_survTimes.size(),
-    //                      false);
-    
-    // errors with const and stuff... what if we copy into new memory?
-    const AVector survTimes(n_survTimes.begin(), n_survTimes.size());
+    const AVector survTimes = shareVector(n_survTimes.begin(), n_survTimes.size());
 
     // censoring status
     const IntVector censInd = as<IntVector>(R_censInd);
@@ -729,12 +726,8 @@ cpp_coxfit(SEXP R_survTimes, SEXP R_censInd, SEXP R_offsets, SEXP R_X, SEXP R_me
 
     // design matrix
     const NumericMatrix n_X = R_X;
-    //const AMatrix X(n_X.begin(), n_X.nrow(),
-    //                n_X.ncol(), false);
-    
-    //Same issue as above L717:721
-    const AMatrix X(n_X.begin(), n_X.nrow(),
-                    n_X.ncol());
+    const AMatrix X = shareMatrix(n_X.begin(), n_X.nrow(),
+                                  n_X.ncol());
     
 
     // tie method
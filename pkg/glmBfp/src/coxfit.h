@@ -83,6 +83,12 @@ typedef Dynamic_2d_array<int> IntMatrix;
 
 // **************************************************************************************
 
+// truncate the linear predictor of an observation to a safe range for exp()
+double
+coxsafe(double x);
+
+// **************************************************************************************
+
 
 struct CoxfitResults
 {
@@ -172,12 +178,13 @@ public:
 
 private:
 
-    // inputs
-    AVector survTimes;
-    IntVector censInd;
+    // inputs: only references to the read-only data, while X is a copy
+    // because it is centered and scaled in place during the fit.
+    const AVector& survTimes;
+    const IntVector& censInd;
     AMatrix X;
-    AVector weights;
-    AVector offsets;
+    const AVector& weights;
+    const AVector& offsets;
     const int method;
 
     const int nObs;
@@ -0,0 +1,282 @@
+/*
+ * credibleBands.cpp
+ */
+
+#include <credibleBands.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <cmath>
+
+using namespace Rcpp;
+
+// ***************************************************************************************************//
+
+SampleMatrix::SampleMatrix(const double* x,
+                           R_xlen_t nrow,
+                           R_xlen_t ncol,
+                           bool samplesInRows) :
+    columns(samplesInRows ? ncol : nrow),
+    n(samplesInRows ? nrow : ncol),
+    stride(samplesInRows ? 1 : nrow)
+{
+    for (R_xlen_t par = 0; par != nPars(); ++par)
+        columns[par] = x + (samplesInRows ? par * nrow : par);
+}
+
+bool
+SampleMatrix::allFinite() const
+{
+    for (R_xlen_t par = 0; par != nPars(); ++par)
+        for (R_xlen_t i = 0; i != n; ++i)
+            if (! R_FINITE(at(i, par)))
+                return false;
+
+    return true;
+}
+
+// ***************************************************************************************************//
+
+// the samples of one parameter, copied into a buffer of the calling thread
+static void
+copyColumn(const SampleMatrix& samples,
+           R_xlen_t par,
+           MyDoubleVector& buffer)
+{
+    buffer.resize(samples.nSamples());
+    for (R_xlen_t i = 0; i != samples.nSamples(); ++i)
+        buffer[i] = samples.at(i, par);
+}
+
+// Rank the absolute distances of the samples of each parameter to the center,
+// with averaged ties as R's rank does, and collect the maximum rank of each sample
+// over all parameters. The parameters are ranked in parallel, each thread keeping
+// its own row maxima, which are merged at the end.
+static void
+rowMaxRanks(const SampleMatrix& samples,
+            const double* center,
+            MyDoubleVector& rowMax)
+{
+    const R_xlen_t n = samples.nSamples();
+    const int nPars = samples.nPars();
+
+    rowMax.assign(n, 0.0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        MyDoubleVector myMax(n, 0.0);
+        std::vector<std::pair<double, R_xlen_t> > order(n);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int par = 0; par < nPars; par++)
+        {
+            for (R_xlen_t i = 0; i != n; ++i)
+                order[i] = std::make_pair(std::fabs(samples.at(i, par) - center[par]), i);
+            std::sort(order.begin(), order.end());
+
+            // walk through the runs of ties
+            for (R_xlen_t start = 0; start != n; )
+            {
+                R_xlen_t end = start + 1;
+                while ((end != n) && (order[end].first == order[start].first))
+                    ++end;
+
+                const double rank = (start + 1 + end) / 2.0;
+                for (R_xlen_t pos = start; pos != end; ++pos)
+                {
+                    const R_xlen_t i = order[pos].second;
+                    myMax[i] = std::max(myMax[i], rank);
+                }
+
+                start = end;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        for (R_xlen_t i = 0; i != n; ++i)
+            rowMax[i] = std::max(rowMax[i], myMax[i]);
+    }
+}
+
+// the k-th smallest value (k starting from 1) of values, by selection
+static double
+kthSmallest(MyDoubleVector values,
+            R_xlen_t k)
+{
+    k = std::max(std::min(k, static_cast<R_xlen_t>(values.size())), static_cast<R_xlen_t>(1));
+    std::nth_element(values.begin(), values.begin() + (k - 1), values.end());
+    return values[k - 1];
+}
+
+// ***************************************************************************************************//
+
+MyDoubleVector
+empiricalHpds(const SampleMatrix& samples,
+              double level)
+{
+    const R_xlen_t n = samples.nSamples();
+    const int nPars = samples.nPars();
+
+    // the number of candidate intervals, each containing n - nIntervals + 1 samples
+    const R_xlen_t nIntervals = static_cast<R_xlen_t>(std::ceil(n * (1.0 - level)));
+
+    MyDoubleVector ret(2 * nPars);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        MyDoubleVector sorted;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int par = 0; par < nPars; par++)
+        {
+            copyColumn(samples, par, sorted);
+
+            // only the nIntervals smallest and largest samples are needed in sorted order
+            if (2 * nIntervals <= n)
+            {
+                std::nth_element(sorted.begin(), sorted.begin() + (nIntervals - 1), sorted.end());
+                std::sort(sorted.begin(), sorted.begin() + nIntervals);
+
+                std::nth_element(sorted.begin() + nIntervals, sorted.begin() + (n - nIntervals), sorted.end());
+                std::sort(sorted.begin() + (n - nIntervals), sorted.end());
+            }
+            else
+            {
+                std::sort(sorted.begin(), sorted.end());
+            }
+
+            // the first interval with the smallest range
+            R_xlen_t smallest = 0;
+            for (R_xlen_t start = 1; start < nIntervals; ++start)
+            {
+                if (sorted[n - nIntervals + start] - sorted[start] <
+                    sorted[n - nIntervals + smallest] - sorted[smallest])
+                    smallest = start;
+            }
+
+            ret[2 * par] = sorted[smallest];
+            ret[2 * par + 1] = sorted[n - nIntervals + smallest];
+        }
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+MyDoubleVector
+scrHpdBand(const SampleMatrix& samples,
+           const MyDoubleVector& mode,
+           double level)
+{
+    const R_xlen_t n = samples.nSamples();
+    const int nPars = samples.nPars();
+
+    // the maximum distance ranks of the samples
+    MyDoubleVector rowMax;
+    rowMaxRanks(samples, mode.data(), rowMax);
+
+    // the rank which divides the samples in contained and rejected samples
+    const double tstar = kthSmallest(rowMax, static_cast<R_xlen_t>(std::floor(level * n)));
+
+    // the parameterwise ranges of the contained samples form the SCB.
+    // Because of ties, possibly more than the required number of samples are contained.
+    MyDoubleVector ret(2 * nPars);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int par = 0; par < nPars; par++)
+    {
+        double lower = std::numeric_limits<double>::infinity();
+        double upper = - std::numeric_limits<double>::infinity();
+
+        for (R_xlen_t i = 0; i != n; ++i)
+        {
+            if (rowMax[i] <= tstar)
+            {
+                const double x = samples.at(i, par);
+                lower = std::min(lower, x);
+                upper = std::max(upper, x);
+            }
+        }
+
+        ret[2 * par] = lower;
+        ret[2 * par + 1] = upper;
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+// check the samples matrix (each column is a sample) and the level, and return the view of the samples
+static SampleMatrix
+getSamples(const NumericMatrix& samples,
+           double level)
+{
+    if (! ((level > 0.0) && (level < 1.0)))
+        Rcpp::stop("level must be in (0, 1)");
+
+    const SampleMatrix ret(samples.begin(), samples.nrow(), samples.ncol(), false);
+
+    if (ret.nSamples() < 1)
+        Rcpp::stop("samples must not be empty");
+    if (! ret.allFinite())
+        Rcpp::stop("samples must be finite");
+
+    return ret;
+}
+
+// the nPars x 2 R matrix from the bounds
+static NumericMatrix
+putBounds(const MyDoubleVector& bounds)
+{
+    const int nPars = bounds.size() / 2;
+
+    NumericMatrix ret(nPars, 2);
+    for (int par = 0; par < nPars; par++)
+    {
+        ret(par, 0) = bounds[2 * par];
+        ret(par, 1) = bounds[2 * par + 1];
+    }
+    return ret;
+}
+
+// [[Rcpp::export]]
+NumericMatrix
+cpp_empiricalHpds(NumericMatrix samples, double level)
+{
+    return putBounds(empiricalHpds(getSamples(samples, level), level));
+}
+
+// [[Rcpp::export]]
+NumericMatrix
+cpp_scrHpd(NumericMatrix samples, NumericVector mode, double level)
+{
+    const SampleMatrix sampleMatrix = getSamples(samples, level);
+
+    if (std::floor(level * sampleMatrix.nSamples()) < 1.0)
+        Rcpp::stop("too few samples for this credible level");
+    if (mode.size() != sampleMatrix.nPars())
+        Rcpp::stop("mode vector must have same length as samples matrix!");
+
+    return putBounds(scrHpdBand(sampleMatrix, as<MyDoubleVector>(mode), level));
+}
+
+// End of credibleBands.cpp
@@ -0,0 +1,75 @@
+/*
+ * credibleBands.h
+ *
+ *  Engine for the (simultaneous) credible bands computed from curve samples:
+ *  the pointwise empirical HPD intervals and the HPD SCB around a mode vector.
+ *  The parameters (grid points) are ranked in parallel, and the row-wise maximum
+ *  ranks are collected in the same pass, without ever storing the matrix of ranks.
+ *  The order statistics which are needed afterwards are found by selection
+ *  instead of full sorts.
+ */
+
+#ifndef CREDIBLEBANDS_H_
+#define CREDIBLEBANDS_H_
+
+#include <types.h>
+#include <rcppExport.h>
+
+#include <vector>
+
+// read-only view of the samples matrix: for each parameter, the pointer to its first sample
+// and the distance between two consecutive samples. So both the layouts "samples in rows"
+// and "samples in columns" of a column-major R matrix can be used without copies.
+class SampleMatrix
+{
+public:
+    // an R matrix with nrow x ncol elements. If samplesInRows, each row is a sample,
+    // otherwise each column.
+    SampleMatrix(const double* x,
+                 R_xlen_t nrow,
+                 R_xlen_t ncol,
+                 bool samplesInRows);
+
+    R_xlen_t
+    nSamples() const
+    {
+        return n;
+    }
+
+    R_xlen_t
+    nPars() const
+    {
+        return columns.size();
+    }
+
+    double
+    at(R_xlen_t sample,
+       R_xlen_t par) const
+    {
+        return columns[par][sample * stride];
+    }
+
+    // are all samples finite?
+    bool
+    allFinite() const;
+
+private:
+    std::vector<const double*> columns;
+    R_xlen_t n;
+    R_xlen_t stride;
+};
+
+// the pointwise empirical HPD intervals of the parameters, as 2 x nPars matrix
+// (lower bounds in the first, upper bounds in the second row)
+MyDoubleVector
+empiricalHpds(const SampleMatrix& samples,
+              double level);
+
+// the HPD SCB around the mode vector: the parameterwise ranges of the samples with
+// maximum distance rank not larger than the level quantile of all maximum ranks
+MyDoubleVector
+scrHpdBand(const SampleMatrix& samples,
+           const MyDoubleVector& mode,
+           double level);
+
+#endif /* CREDIBLEBANDS_H_ */
@@ -7,6 +7,7 @@
 #include <dataStructure.h>
 #include <sum.h>
 #include <functionWraps.h>
+#include <perfCounters.h>
 #include <fpUcHandling.h>
 
 #include <rcppExport.h>
@@ -122,9 +123,14 @@ Book::Book(bool tbf,
            double largeVariance,
            bool useBfgs,
            bool debug,
-           bool higherOrderCorrection) :
+           bool higherOrderCorrection,
+           PosInt zCachePoints,
+           double quadratureTolerance,
+           double laplaceThreshold) :
            modelCounter(0),
                 nanCounter(0),
+                laplaceOnlyCounter(0),
+                maxLogPosterior(R_NegInf),
                 tbf(tbf),
                 doGlm(doGlm),
                 empiricalBayes(empiricalBayes),
@@ -138,7 +144,10 @@ Book::Book(bool tbf,
                 largeVariance(largeVariance),
                 useBfgs(useBfgs),
                 debug(debug),
-                higherOrderCorrection(higherOrderCorrection)
+                higherOrderCorrection(higherOrderCorrection),
+                zCachePoints(zCachePoints),
+                quadratureTolerance(quadratureTolerance),
+                laplaceThreshold(laplaceThreshold)
 {
     if (doSampling)
     {
@@ -179,7 +188,8 @@ GlmModelInfo::convert2list(long double logNormConst,
                         _["zMode"] = zMode,
                         _["zVar"] = zVar,
                         _["laplaceApprox"] = laplaceApprox,
-                        _["residualDeviance"] = residualDeviance);
+                        _["residualDeviance"] = residualDeviance,
+                        _["laplaceOnly"] = laplaceOnly);
 }
 
 
@@ -336,85 +346,6 @@ ModelPar::convert2list(const FpInfo& currFp) const
 }
 
 
-// ***************************************************************************************************//
-
-// compute set of free uc group indices in a model configuration
-IntSet
-ModelPar::getFreeUcs(const PosIntVector& ucSizes,
-                     const PosInt& currDim,
-                     const PosInt& maxDim) const
-{
-    IntSet ret;
-
-    for (PosIntVector::size_type i = 1; i <= ucSizes.size(); i++)
-    { // for every uc index
-        if ((find(ucPars.begin(), ucPars.end(), i) == ucPars.end())
-                && (ucSizes.at(i - 1) <= maxDim - currDim))
-        {
-            ret.insert(i); // insert if not already in model and enough space in design matrix
-        }
-    }
-
-    return ret;
-}
-
-// ***************************************************************************************************//
-
-// compute set of free cov indices in a model configuration
-PosIntSet
-ModelPar::getFreeCovs(const FpInfo& currFp,
-                      const IntSet& freeUcs,
-                      const PosInt& currDim,
-                      const PosInt& maxDim) const
-{
-    PosIntSet ret;
-
-    if (currDim == maxDim)
-    {
-        return ret;
-    }
-
-    for (PosInt i = 0; i != fpPars.size(); i++)
-    {
-        if (fpPars.at(i).size() < currFp.fpmaxs.at(i))
-        {
-            ret.insert(i + 1);
-        }
-    }
-
-    if (! freeUcs.empty())
-    {
-        ret.insert(fpPars.size() + 1);
-    }
-
-    return ret;
-}
-
-// ***************************************************************************************************//
-
-// determine set of present cov indices
-PosIntSet
-ModelPar::getPresentCovs() const
-{
-    PosIntSet ret;
-
-    for (PosInt i = 0; i != fpPars.size(); i++)
-    {
-        if (! fpPars.at(i).empty())
-        {
-            ret.insert(i + 1);
-        }
-    }
-
-    if (! ucPars.empty())
-    {
-        ret.insert(fpPars.size() + 1);
-    }
-
-    return ret;
-}
-
-
 // ***************************************************************************************************//
 
 // push back index into covGroupWisePosteriors-Array
@@ -463,6 +394,28 @@ ModelPar::pushInclusionProbs(const FpInfo& fpInfo,
 
 // ***************************************************************************************************//
 
+// save to a checkpoint
+void
+ModelPar::save(CheckpointWriter& checkpoint) const
+{
+    checkpoint.write(fpPars);
+    checkpoint.write(fpSize);
+    checkpoint.write(ucPars);
+    checkpoint.write(fixPars);
+}
+
+// restore from a checkpoint
+void
+ModelPar::restore(CheckpointReader& checkpoint)
+{
+    checkpoint.read(fpPars);
+    checkpoint.read(fpSize);
+    checkpoint.read(ucPars);
+    checkpoint.read(fixPars);
+}
+
+// ***************************************************************************************************//
+
 // return the size of the model (excluding the intercept),
 // i.e. the number of coefficients
 PosInt 
@@ -510,11 +463,15 @@ Model::convert2list(const FpInfo& currFp,
 // compute nodes and log weights for given mode and var of target unnormalized density
 void
 GaussHermite::getNodesAndLogWeights(double mode, double var,
-                                    MyDoubleVector& nodes, MyDoubleVector& logWeights) const // output
+                                    MyDoubleVector& nodes, MyDoubleVector& logWeights, // output
+                                    PosInt rule) const
 {
     // logarithm of square root of (2 * var).
     double logSqrt2Var = 0.5 * (M_LN2 + log(var));
 
+    const MyDoubleVector& tVec = tVecs.at(rule);
+    const MyDoubleVector& wVec = wVecs.at(rule);
+
     MyDoubleVector::const_iterator t = tVec.begin();
     for(MyDoubleVector::const_iterator
             w = wVec.begin();
@@ -526,6 +483,24 @@ GaussHermite::getNodesAndLogWeights(double mode, double var,
     }
 }
 
+// constructor
+GaussHermite::GaussHermite(List rcpp_gaussHermite)
+{
+    if(rcpp_gaussHermite.containsElementNamed("lowerOrders"))
+    {
+        List rcpp_lowerOrders = rcpp_gaussHermite["lowerOrders"];
+        for(R_len_t i = 0; i != rcpp_lowerOrders.size(); ++i)
+        {
+            List rcpp_rule = rcpp_lowerOrders[i];
+            tVecs.push_back(as<MyDoubleVector>(rcpp_rule["nodes"]));
+            wVecs.push_back(as<MyDoubleVector>(rcpp_rule["weights"]));
+        }
+    }
+
+    tVecs.push_back(as<MyDoubleVector>(rcpp_gaussHermite["nodes"]));
+    wVecs.push_back(as<MyDoubleVector>(rcpp_gaussHermite["weights"]));
+}
+
 // ***************************************************************************************************//
 
 // GlmModelConfig //
@@ -557,55 +532,12 @@ GlmModelConfig::GlmModelConfig(List& rcpp_family,
     // and the phi from the R family object
     const double phi = rcpp_family["phi"];
 
-    if (familyString == "binomial")
-    {
-        distribution = new Binomial(responses,
-                                    weights);
-    }
-    else if (familyString == "gaussian")
-    {
-        distribution = new Gaussian(responses,
-                                    weights,
-                                    phi);
-    }
-    else if (familyString == "poisson")
-    {
-        distribution = new Poisson(responses,
-                                   weights);
-    }
-    else
-    {
-        Rcpp::stop("Distribution not implemented");
-    }
+    distribution = newDistribution(familyString,
+                                   responses,
+                                   weights,
+                                   phi);
 
-    if (linkString == "logit")
-    {
-        link = new LogitLink();
-    }
-    else if (linkString == "probit")
-    {
-        link = new ProbitLink();
-    }
-    else if (linkString == "cloglog")
-    {
-        link = new CloglogLink();
-    }
-    else if (linkString == "inverse")
-    {
-        link = new InverseLink();
-    }
-    else if (linkString == "log")
-    {
-        link = new LogLink();
-    }
-    else if (linkString == "identity")
-    {
-        link = new IdentityLink();
-    }
-    else
-    {
-        Rcpp::stop("Link not implemented!");
-    }
+    link = newLink(linkString);
 
 
     if (useFixedc) {
@@ -674,6 +606,8 @@ GlmModelConfig::GlmModelConfig(List& rcpp_family,
 // dataValues //
 
 // 03/12/2012: add censoring indicator vector
+// the matrices and the response are views of the memory of x, xcentered and y,
+// which must therefore stay alive as long as this object.
 
 DataValues::DataValues(const AMatrix &x,
                        const AMatrix &xcentered,
@@ -681,9 +615,9 @@ DataValues::DataValues(const AMatrix &x,
                        const IntVector &censInd,
                        const double &totalNum,
                        const IntSet& fixedCols) :
-            design(x),
-            centeredDesign(xcentered),
-            response(y),
+            design(const_cast<double*>(x.memptr()), x.n_rows, x.n_cols, false, true),
+            centeredDesign(const_cast<double*>(xcentered.memptr()), xcentered.n_rows, xcentered.n_cols, false, true),
+            response(const_cast<double*>(y.memptr()), y.n_elem, false, true),
             censInd(censInd),
             nObs(design.n_rows),
             onesVector(arma::ones<AVector>(nObs)),
@@ -724,6 +658,8 @@ ModelCache::insert(const ModelPar& par, const GlmModelInfo& info)
             modelMap.erase(worstModelIter);
             // and then from the set
             modelIterSet.erase(modelIterSet.begin());
+
+            perfCounters.increment(PerfCounters::modelCacheEvictions);
         }
         else
         {
@@ -766,9 +702,15 @@ ModelCache::getModelInfo(const ModelPar& par) const
 
     // if found, return the log marg lik
     if(ret != modelMap.end())
+    {
+        perfCounters.increment(PerfCounters::modelCacheHits);
         return ret->second;
+    }
     else
+    {
+        perfCounters.increment(PerfCounters::modelCacheMisses);
         return GlmModelInfo(R_NaReal, R_NaReal, Cache(), 0.0, 0.0, 0.0, R_NaReal);
+    }
 }
 
 // increment the sampling frequency for a model configuration
@@ -784,6 +726,78 @@ ModelCache::incrementFrequency(const ModelPar& par)
         ret->second.hits++;
 }
 
+// save all cached models to a checkpoint
+void
+ModelCache::save(CheckpointWriter& checkpoint) const
+{
+    checkpoint.write(static_cast<PosLargeInt>(modelMap.size()));
+
+    for(MapType::const_iterator
+            m = modelMap.begin();
+            m != modelMap.end();
+            ++m)
+    {
+        m->first.save(checkpoint);
+
+        const GlmModelInfo& info = m->second;
+        checkpoint.write(info.logMargLik);
+        checkpoint.write(info.logPrior);
+        checkpoint.write(info.hits);
+        checkpoint.write(info.negLogUnnormZDensities.getArgs());
+        checkpoint.write(info.negLogUnnormZDensities.getVals());
+        checkpoint.write(info.zMode);
+        checkpoint.write(info.zVar);
+        checkpoint.write(info.laplaceApprox);
+        checkpoint.write(info.residualDeviance);
+        checkpoint.write(info.laplaceOnly);
+    }
+}
+
+// replace the cached models by those from a checkpoint
+void
+ModelCache::restore(CheckpointReader& checkpoint)
+{
+    modelIterSet.clear();
+    modelMap.clear();
+
+    PosLargeInt nModels;
+    checkpoint.read(nModels);
+
+    for(; nModels != 0; --nModels)
+    {
+        ModelPar par(0);
+        par.restore(checkpoint);
+
+        double logMargLik, logPrior, zMode, zVar, laplaceApprox, residualDeviance;
+        bool laplaceOnly;
+        PosLargeInt hits;
+        MyDoubleVector args, vals;
+
+        checkpoint.read(logMargLik);
+        checkpoint.read(logPrior);
+        checkpoint.read(hits);
+        checkpoint.read(args);
+        checkpoint.read(vals);
+        checkpoint.read(zMode);
+        checkpoint.read(zVar);
+        checkpoint.read(laplaceApprox);
+        checkpoint.read(residualDeviance);
+        checkpoint.read(laplaceOnly);
+
+        Cache cache;
+        for(PosInt i = 0; i < args.size() && i < vals.size(); ++i)
+        {
+            cache.save(args[i], vals[i]);
+        }
+
+        GlmModelInfo info(logMargLik, logPrior, cache, zMode, zVar, laplaceApprox, residualDeviance,
+                          laplaceOnly);
+        info.hits = hits;
+
+        insert(par, info);
+    }
+}
+
 // compute the log normalising constant from all cached models
 long double
 ModelCache::getLogNormConstant() const
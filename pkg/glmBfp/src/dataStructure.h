@@ -7,6 +7,7 @@
 #include <iterator>
 #include <numeric>
 #include <string>
+#include <algorithm>
 
 #include <rcppExport.h>
 #include <types.h>
@@ -15,6 +16,8 @@
 #include <links.h>
 #include <distributions.h>
 #include <gpriors.h>
+#include <denseIndexSet.h>
+#include <checkpoint.h>
 
 
 // ***************************************************************************************************//
@@ -69,6 +72,12 @@ struct Book
     PosLargeInt chainlength;
     PosLargeInt nanCounter;
 
+    // number of models for which only the Laplace approximation was computed
+    PosLargeInt laplaceOnlyCounter;
+
+    // the maximum (varying part of the) log posterior of the models computed so far
+    double maxLogPosterior;
+
     SafeSum modelLogPosteriors;
     //IndexSafeSum *covGroupWisePosteriors; // for computation of covariate inclusion probs: array (bfp, uc)
     std::vector<IndexSafeSum> covGroupWisePosteriors; // for computation of covariate inclusion probs: array (bfp, uc)
@@ -91,6 +100,26 @@ struct Book
 
     const bool higherOrderCorrection;
 
+    // number of z density evaluations kept per cached model (0: all)
+    const PosInt zCachePoints;
+
+    // tolerance for the log marginal likelihoods of successive Gauss-Hermite orders
+    // (0: only the full order is used)
+    const double quadratureTolerance;
+
+    // models whose Laplace log posterior is more than this below the maximum get only
+    // the Laplace approximation (infinite: never)
+    const double laplaceThreshold;
+
+    // the lower bound for the Laplace approximation of the log marginal likelihood of a
+    // model with this log prior, below which the quadrature is skipped
+    double
+    laplaceOnlyBound(double logPrior) const
+    {
+        return R_finite(laplaceThreshold) ?
+                maxLogPosterior - laplaceThreshold - logPrior : R_NegInf;
+    }
+
     // constructor which checks the chainlength
     Book(bool tbf,
          bool doGlm,
@@ -106,7 +135,10 @@ struct Book
          double largeVariance,
          bool useBfgs,
          bool debug,
-         bool higherOrderCorrection);
+         bool higherOrderCorrection,
+         PosInt zCachePoints = 0,
+         double quadratureTolerance = 0.0,
+         double laplaceThreshold = R_PosInf);
 
 };
 
@@ -184,14 +216,16 @@ struct GlmModelInfo : public ModelInfo
                  double zMode,
                  double zVar,
                  double laplaceApprox,
-                 double residualDeviance) :
+                 double residualDeviance,
+                 bool laplaceOnly = false) :
                      ModelInfo(logMargLik,
                                logPrior),
                      negLogUnnormZDensities(cache),
                      zMode(zMode),
                      zVar(zVar),
                      laplaceApprox(laplaceApprox),
-                     residualDeviance(residualDeviance)
+                     residualDeviance(residualDeviance),
+                     laplaceOnly(laplaceOnly)
                      {
                      }
 
@@ -214,6 +248,10 @@ struct GlmModelInfo : public ModelInfo
     // this is only filled in the TBF case
     double residualDeviance;
 
+    // is the log marginal likelihood only the Laplace approximation, because
+    // the model was negligible?
+    bool laplaceOnly;
+
     // convert to R list
     Rcpp::List
     convert2list(long double logNormConst,
@@ -229,7 +267,9 @@ struct GlmModelInfo : public ModelInfo
                   zMode(rcpp_information["zMode"]),
                   zVar(rcpp_information["zVar"]),
                   laplaceApprox(rcpp_information["laplaceApprox"]),
-                  residualDeviance(rcpp_information["residualDeviance"])
+                  residualDeviance(rcpp_information["residualDeviance"]),
+                  laplaceOnly(rcpp_information.containsElementNamed("laplaceOnly") ?
+                              Rcpp::as<bool>(rcpp_information["laplaceOnly"]) : false)
     {
     }
 };
@@ -277,22 +317,12 @@ struct ModelPar
     ModelPar(Rcpp::List rcpp_configuration,
              const FpInfo& fpInfo);
 
-    // compute set of free uc group indices in a model configuration
-    IntSet
-    getFreeUcs(const PosIntVector& ucSizes,
-               const PosInt& currDim,
-               const PosInt& maxDim) const;
-
-    // compute set of free cov indices in a model configuration
-    PosIntSet
-    getFreeCovs(const FpInfo& currFp,
-                const IntSet& freeUcs,
-                const PosInt& currDim,
-                const PosInt& maxDim) const;
+    // save to a checkpoint, and restore from there
+    void
+    save(CheckpointWriter& checkpoint) const;
 
-    // determine set of present cov indices
-    PosIntSet
-    getPresentCovs() const;
+    void
+    restore(CheckpointReader& checkpoint);
 
     // push back index into covGroupWisePosteriors-Array
     void
@@ -341,23 +371,38 @@ struct Model
 // ***************************************************************************************************//
 
 
+// The rules of increasing orders for the adaptive quadrature: the optional lower order rules
+// from the list element "lowerOrders", and the full rule, which is always the last one.
 class GaussHermite {
 public:
-    // compute nodes and log weights for given mode and sd of target unnormalized density
+    // compute nodes and log weights for given mode and sd of target unnormalized density,
+    // with the rule of the given index
+    void
+    getNodesAndLogWeights(double mode, double var,
+                       MyDoubleVector& nodes, MyDoubleVector& logWeights, // output
+                       PosInt rule) const;
+
+    // the same with the full rule
     void
     getNodesAndLogWeights(double mode, double var,
-                       MyDoubleVector& nodes, MyDoubleVector& logWeights) const; // output
+                       MyDoubleVector& nodes, MyDoubleVector& logWeights) const // output
+    {
+        getNodesAndLogWeights(mode, var, nodes, logWeights, nRules() - 1);
+    }
+
+    // number of rules
+    PosInt
+    nRules() const
+    {
+        return tVecs.size();
+    }
 
     // constructor
-    GaussHermite(Rcpp::List rcpp_gaussHermite) :
-        tVec(Rcpp::as<MyDoubleVector>(rcpp_gaussHermite["nodes"])),
-        wVec(Rcpp::as<MyDoubleVector>(rcpp_gaussHermite["weights"]))
-        {
-        }
+    GaussHermite(Rcpp::List rcpp_gaussHermite);
 
 private:
-    const MyDoubleVector tVec; // nodes
-    const MyDoubleVector wVec; // weights (not log!)
+    std::vector<MyDoubleVector> tVecs; // nodes
+    std::vector<MyDoubleVector> wVecs; // weights (not log!)
 };
 
 
@@ -528,6 +573,14 @@ public:
                         long double logNormConst,
                         const Book& bookkeep) const;
 
+    // save all cached models with their infos and sampling frequencies to a checkpoint,
+    // and replace the contents of the cache by those from a checkpoint
+    void
+    save(CheckpointWriter& checkpoint) const;
+
+    void
+    restore(CheckpointReader& checkpoint);
+
 
 private:
     // the map type
@@ -564,23 +617,145 @@ struct ModelMcmc
               double logMargLikNullModel) :
                   modPar(fpInfo.nFps),
                   dim(1),
-                  freeUcs(modPar.getFreeUcs(ucInfo.ucSizes, dim, maxDim)),
-                  freeCovs(modPar.getFreeCovs(fpInfo, freeUcs, dim, maxDim)),
-                  presentCovs(modPar.getPresentCovs()),
+                  freeUcs(ucInfo.nUcGroups),
+                  freeCovs(fpInfo.nFps + 1),
+                  presentCovs(fpInfo.nFps + 1),
                   birthprob(1.0),
                   deathprob(0.0),
                   moveprob(0.0),
                   logMargLik(logMargLikNullModel),
                   logPrior(R_NaN)
     {
+        // a group is free if it is not yet in the model and fits into the design matrix
+        for (PosInt i = 1; i <= ucInfo.nUcGroups; i++)
+        {
+            freeUcs.set(i, ucInfo.ucSizes[i - 1] <= maxDim - dim);
+        }
+
+        // all FPs are checked, as when the dimension limit is left
+        updateFreeCovs(fpInfo, maxDim, maxDim, 0);
+    }
+
+    // update the free uc groups in place, after the dimension changed from oldDim and the
+    // uc group changedUc (0 for none) entered or left the model. Only changedUc and the groups
+    // whose size lies between the old and the new free dimension are checked.
+    void
+    updateFreeUcs(const UcInfo& ucInfo,
+                  PosInt maxDim,
+                  PosInt oldDim,
+                  PosInt changedUc)
+    {
+        const PosInt oldSpace = maxDim - oldDim;
+        const PosInt space = maxDim - dim;
+
+        // the groups which fit into exactly one of the two spaces
+        if (! ucInfo.ucGroupsBySize.empty())
+        {
+            const PosInt first = std::min(oldSpace, space) + 1;
+            const PosInt last = std::min(std::max(oldSpace, space),
+                                         static_cast<PosInt>(ucInfo.ucGroupsBySize.size() - 1));
+            for (PosInt s = first; s <= last; s++)
+            {
+                const PosIntVector& groups = ucInfo.ucGroupsBySize[s];
+                for (PosIntVector::const_iterator i = groups.begin(); i != groups.end(); ++i)
+                {
+                    freeUcs.set(*i, (modPar.ucPars.count(*i) == 0) && (s <= space));
+                }
+            }
+        }
+
+        if (changedUc > 0)
+        {
+            freeUcs.set(changedUc,
+                        (modPar.ucPars.count(changedUc) == 0) && (ucInfo.ucSizes.at(changedUc - 1) <= space));
+        }
+    }
+
+    // update the free covs in place, after the dimension changed from oldDim and the powers of the
+    // FPs changedFp1 and changedFp2 (0 for none) changed, using the current free uc groups.
+    // Only these FPs are checked, unless the model reached or left the dimension limit.
+    void
+    updateFreeCovs(const FpInfo& fpInfo,
+                   PosInt maxDim,
+                   PosInt oldDim,
+                   PosInt changedFp1,
+                   PosInt changedFp2 = 0)
+    {
+        if (dim == maxDim)
+        {
+            freeCovs.clear();
+            return;
+        }
+
+        if (oldDim == maxDim)
+        { // the set was cleared at the limit
+            for (PosInt i = 0; i != fpInfo.nFps; i++)
+            {
+                freeCovs.set(i + 1, modPar.fpPars[i].size() < fpInfo.fpmaxs[i]);
+            }
+        }
+        else
+        {
+            const PosInt changed[2] = {changedFp1, changedFp2};
+            for (int j = 0; j != 2; j++)
+            {
+                if ((changed[j] > 0) && (changed[j] <= fpInfo.nFps))
+                    freeCovs.set(changed[j], modPar.fpPars[changed[j] - 1].size() < fpInfo.fpmaxs[changed[j] - 1]);
+            }
+        }
+
+        freeCovs.set(fpInfo.nFps + 1, ! freeUcs.empty());
+    }
+
+    // update whether the cov covInd (fp index, or nFps + 1 for the uc groups) is present
+    void
+    updatePresentCov(PosInt covInd)
+    {
+        const PosInt nFps = modPar.fpPars.size();
+
+        presentCovs.set(covInd,
+                        (covInd <= nFps) ? (! modPar.fpPars[covInd - 1].empty()) : (! modPar.ucPars.empty()));
+    }
+
+    // save the complete state to a checkpoint, and restore it
+    void
+    save(CheckpointWriter& checkpoint) const
+    {
+        modPar.save(checkpoint);
+        checkpoint.write(dim);
+        freeUcs.save(checkpoint);
+        freeCovs.save(checkpoint);
+        presentCovs.save(checkpoint);
+        checkpoint.write(birthprob);
+        checkpoint.write(deathprob);
+        checkpoint.write(moveprob);
+        checkpoint.write(logMargLik);
+        checkpoint.write(logPrior);
+    }
+
+    void
+    restore(CheckpointReader& checkpoint)
+    {
+        modPar.restore(checkpoint);
+        checkpoint.read(dim);
+        freeUcs.restore(checkpoint);
+        freeCovs.restore(checkpoint);
+        presentCovs.restore(checkpoint);
+        checkpoint.read(birthprob);
+        checkpoint.read(deathprob);
+        checkpoint.read(moveprob);
+        checkpoint.read(logMargLik);
+        checkpoint.read(logPrior);
     }
 
     ModelPar modPar;
     PosInt dim; // number of columns in this model's design matrix
 
-    IntSet freeUcs; // indices within uc groups, denoting the birthable ones
-    PosIntSet freeCovs; // indices of free covs (starting from first fp with index 1 up to uc index = nFps + 1)
-    PosIntSet presentCovs; // analogue
+    // these are maintained incrementally by the sampler, so that
+    // random selection from them is O(1) and no memory is allocated per step.
+    DenseIndexSet freeUcs; // indices within uc groups, denoting the birthable ones
+    DenseIndexSet freeCovs; // indices of free covs (starting from first fp with index 1 up to uc index = nFps + 1)
+    DenseIndexSet presentCovs; // analogue
 
     double birthprob, deathprob, moveprob; // move type probabilites, switchprob is 1-bprob-dprob-mprob.
     double logMargLik;
@@ -8,6 +8,7 @@
 #include <design.h>
 #include <fpUcHandling.h>
 #include <dataStructure.h>
+#include <perfCounters.h>
 
 #include <rcppExport.h>
 #include <types.h>
@@ -34,49 +35,41 @@ getMultipleCols(const AMatrix& m,
 
 // ***************************************************************************************************//
 
-// build Fp basis matrix from vector, power indices and power set for one covariate
-AMatrix
-getFpMatrix(const std::vector<AVector>& tcols,
-            const Powers& powerinds,
-            const DataValues& data)
+// copy the centered FP columns for FP number fp and power indices from the basis cache
+// into ret, starting at column firstColumn. No arithmetic is needed: the
+// multiset is ordered, so repeated powers are adjacent and only the repeat level
+// has to be counted.
+static void
+gatherFpColumns(AMatrix& ret,
+                PosInt firstColumn,
+                const FpInfo& fpInfo,
+                const PosInt fp,
+                const Powers& powerinds)
 {
-    const int logInd = 3; // this index corresponds to power = 0, i.e. log.
-    const int nrow = tcols.at(1).n_elem;
-
-    // get the log column
-    const AVector& logColumn = tcols.at(logInd);
-
-    // this will be the returned matrix
-    AMatrix ret(nrow, powerinds.size());
-
-    // start recursion
-    int lastInd = logInd;
-    AVector lastCol = arma::ones<AVector>(nrow);
-
-    // there is at least one power present
-    Powers::size_type cols = 0; // invariant: about to process column number "cols"
+    Int lastInd = -1;
+    PosInt repeat = 0;
 
     for (Powers::const_iterator
          now = powerinds.begin();
          now != powerinds.end();
          now++)
     {
-        if (*now == lastInd)
-        { // repeated powers case:
+        repeat = (*now == lastInd) ? repeat + 1 : 0;
+        lastInd = *now;
 
-            // elementwise multiplication (Schur product):
-            lastCol = lastCol % logColumn;
-        }
-        else
-        { // normal case
-
-            lastInd = *now;
-            lastCol = tcols.at(lastInd);
-        }
-        // center the column
-        ret.col(cols++) = lastCol - arma::mean(lastCol);
+        fpInfo.copyBasisColumn(fp, lastInd, repeat, ret.colptr(firstColumn++));
     }
+}
 
+// build Fp basis matrix for FP number fp and power indices,
+// gathered from the basis cache in fpInfo
+AMatrix
+getFpMatrix(const FpInfo& fpInfo,
+            const PosInt fp,
+            const Powers& powerinds)
+{
+    AMatrix ret(fpInfo.nObs, powerinds.size());
+    gatherFpColumns(ret, 0, fpInfo, fp, powerinds);
     return ret;
 }
 
@@ -92,6 +85,8 @@ getDesignMatrix(const ModelPar &mod,
                 const FixInfo& fixInfo,
                 bool includeIntercept)
 {
+    PhaseTimer timer(PerfCounters::designPhase);
+
     // total number of columns
     int nColumns = mod.size(ucInfo, fixInfo); 
     if(includeIntercept)
@@ -115,19 +110,13 @@ getDesignMatrix(const ModelPar &mod,
     // go on with centered fp matrices
     for (PosInt i = 0; i != fpInfo.nFps; i++)
     {
-        Powers powersi = mod.fpPars.at(i);
-
-        if (! powersi.empty())
-        {
-            // what is the end column in the return matrix?
-            PosInt endColumn = nextColumn + powersi.size() - 1;
+        const Powers& powersi = mod.fpPars.at(i);
 
-            // insert the centered FP matrix into the return matrix
-            ret.cols(nextColumn, endColumn) = getFpMatrix(fpInfo.tcols.at(i), powersi, data);
+        // insert the centered FP columns directly into the return matrix
+        gatherFpColumns(ret, nextColumn, fpInfo, i, powersi);
 
-            // correct invariant
-            nextColumn = endColumn + 1;
-        }
+        // correct invariant
+        nextColumn += powersi.size();
     }
 
     // centered uc matrices
@@ -181,6 +170,190 @@ getDesignMatrix(const ModelPar &mod,
 
 // ***************************************************************************************************//
 
+StructuredDesign::StructuredDesign(const AMatrix& design,
+                                   const ModelPar &mod,
+                                   const FpInfo &fpInfo,
+                                   const UcInfo& ucInfo) :
+                                   dense(),
+                                   denseColumns(),
+                                   factors(),
+                                   nObs(design.n_rows),
+                                   nCoefs(design.n_cols)
+{
+    // the columns are ordered as in getDesignMatrix: intercept, FPs, UC groups and fixed groups
+    PosInt nextColumn = 1 + mod.fpSize;
+
+    std::vector<bool> isDense(nCoefs, true);
+    for(IntSet::const_iterator
+            g = mod.ucPars.begin();
+            g != mod.ucPars.end();
+            ++g)
+    {
+        const FactorCoding& coding = ucInfo.ucFactors.at(*g - 1);
+        const PosInt size = ucInfo.ucColList.at(*g - 1).size();
+
+        if(coding.isFactor())
+        {
+            Factor factor = {&coding, nextColumn};
+            factors.push_back(factor);
+
+            std::fill(isDense.begin() + nextColumn, isDense.begin() + nextColumn + size, false);
+        }
+
+        nextColumn += size;
+    }
+
+    if(hasFactors())
+    {
+        std::vector<arma::uword> cols;
+        for(PosInt j = 0; j != nCoefs; ++j)
+        {
+            if(isDense[j])
+            {
+                cols.push_back(j);
+            }
+        }
+        denseColumns = arma::conv_to<arma::uvec>::from(cols);
+        dense = design.cols(denseColumns);
+    }
+}
+
+// C := X' diag(w) X + beta * C
+void
+StructuredDesign::weightedCrossprod(const AVector& w,
+                                    double beta,
+                                    AMatrix& C) const
+{
+    AMatrix ret(nCoefs, nCoefs);
+
+    // the dense block
+    AMatrix denseW = dense;
+    denseW.each_col() %= w;
+    ret.submat(denseColumns, denseColumns) = arma::trans(dense) * denseW;
+
+    for(std::vector<Factor>::const_iterator
+            f = factors.begin();
+            f != factors.end();
+            ++f)
+    {
+        const PosIntVector& codes = f->coding->codes;
+        const AMatrix& values = f->coding->levelValues;
+        const PosInt nCols = values.n_cols;
+        const PosInt first = f->firstColumn;
+        const PosInt last = first + nCols - 1;
+
+        // the weight sums of the levels, and the level sums of the weighted dense columns
+        AVector levelWeights = arma::zeros<AVector>(values.n_rows);
+        for(PosInt i = 0; i != nObs; ++i)
+        {
+            levelWeights(codes[i]) += w(i);
+        }
+
+        AMatrix levelDense(values.n_rows, dense.n_cols);
+        for(PosInt c = 0; c != dense.n_cols; ++c)
+        {
+            AVector sums = arma::zeros<AVector>(values.n_rows);
+            const double* col = denseW.colptr(c);
+            for(PosInt i = 0; i != nObs; ++i)
+            {
+                sums(codes[i]) += col[i];
+            }
+            levelDense.col(c) = sums;
+        }
+
+        ret.submat(first, first, last, last) = arma::trans(values) * arma::diagmat(levelWeights) * values;
+
+        const AMatrix factorDense = arma::trans(values) * levelDense;
+        ret.submat(arma::regspace<arma::uvec>(first, last), denseColumns) = factorDense;
+        ret.submat(denseColumns, arma::regspace<arma::uvec>(first, last)) = arma::trans(factorDense);
+
+        // the weighted contingency tables with the factors before this one
+        for(std::vector<Factor>::const_iterator
+                e = factors.begin();
+                e != f;
+                ++e)
+        {
+            const PosIntVector& otherCodes = e->coding->codes;
+            const AMatrix& otherValues = e->coding->levelValues;
+            const PosInt otherFirst = e->firstColumn;
+            const PosInt otherLast = otherFirst + otherValues.n_cols - 1;
+
+            AMatrix table = arma::zeros<AMatrix>(values.n_rows, otherValues.n_rows);
+            for(PosInt i = 0; i != nObs; ++i)
+            {
+                table(codes[i], otherCodes[i]) += w(i);
+            }
+
+            const AMatrix factorFactor = arma::trans(values) * table * otherValues;
+            ret.submat(first, otherFirst, last, otherLast) = factorFactor;
+            ret.submat(otherFirst, first, otherLast, last) = arma::trans(factorFactor);
+        }
+    }
+
+    if(beta == 0.0)
+    {
+        C = ret;
+    }
+    else
+    {
+        C = beta * C + ret;
+    }
+}
+
+// X' v
+AVector
+StructuredDesign::transTimes(const AVector& v) const
+{
+    AVector ret(nCoefs);
+    ret.elem(denseColumns) = arma::trans(dense) * v;
+
+    for(std::vector<Factor>::const_iterator
+            f = factors.begin();
+            f != factors.end();
+            ++f)
+    {
+        const PosIntVector& codes = f->coding->codes;
+        const AMatrix& values = f->coding->levelValues;
+
+        AVector levelSums = arma::zeros<AVector>(values.n_rows);
+        for(PosInt i = 0; i != nObs; ++i)
+        {
+            levelSums(codes[i]) += v(i);
+        }
+
+        ret.subvec(f->firstColumn, f->firstColumn + values.n_cols - 1) = arma::trans(values) * levelSums;
+    }
+
+    return ret;
+}
+
+// X * b
+AVector
+StructuredDesign::times(const AVector& b) const
+{
+    AVector ret = dense * b.elem(denseColumns);
+
+    for(std::vector<Factor>::const_iterator
+            f = factors.begin();
+            f != factors.end();
+            ++f)
+    {
+        const PosIntVector& codes = f->coding->codes;
+        const AMatrix& values = f->coding->levelValues;
+
+        // the linear predictor contribution of each level
+        const AVector levelEffects = values * b.subvec(f->firstColumn, f->firstColumn + values.n_cols - 1);
+        for(PosInt i = 0; i != nObs; ++i)
+        {
+            ret(i) += levelEffects(codes[i]);
+        }
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
 
 
 // End of file.
@@ -11,6 +11,13 @@
 #include <dataStructure.h>
 #include <types.h>
 
+// build Fp basis matrix for FP number fp and power indices,
+// gathered from the basis cache in fpInfo
+AMatrix
+getFpMatrix(const FpInfo& fpInfo,
+            const PosInt fp,
+            const Powers& powerinds);
+
 // construct centered design matrix including intercept for the model
 // optionally the intercept column is not included
 AMatrix
@@ -21,6 +28,58 @@ getDesignMatrix(const ModelPar &mod,
                 const FixInfo& fixInfo,
                 bool includeIntercept = true);
 
+// the design matrix of a model (including the intercept), where the UC groups which are
+// factors are kept in level code form. Then their contributions to the weighted crossproduct,
+// to X'v and to X*b are grouped sums over the observations, which cost O(n) instead of
+// O(n * levels) per factor. The other columns are handled as dense matrix.
+class StructuredDesign
+{
+public:
+    StructuredDesign(const AMatrix& design,
+                     const ModelPar &mod,
+                     const FpInfo &fpInfo,
+                     const UcInfo& ucInfo);
+
+    // are there any factors? Otherwise the dense design matrix is faster to use.
+    bool
+    hasFactors() const
+    {
+        return ! factors.empty();
+    }
+
+    // C := X' diag(w) X + beta * C
+    // (the full matrix is written, and C is not read if beta is zero)
+    void
+    weightedCrossprod(const AVector& w,
+                      double beta,
+                      AMatrix& C) const;
+
+    // X' v
+    AVector
+    transTimes(const AVector& v) const;
+
+    // X * b
+    AVector
+    times(const AVector& b) const;
+
+private:
+    // a factor with its first column in the design matrix
+    struct Factor
+    {
+        const FactorCoding* coding;
+        PosInt firstColumn;
+    };
+
+    // the remaining (dense) columns and their indices in the design matrix
+    AMatrix dense;
+    arma::uvec denseColumns;
+
+    std::vector<Factor> factors;
+
+    PosInt nObs;
+    PosInt nCoefs;
+};
+
 
 
 #endif /* DESIGN_H_ */
@@ -77,3 +77,35 @@ Poisson::loglik(const double *means) const
 
     return ret;
 }
+
+// ***************************************************************************************************//
+
+
+// get a new distribution object for the family name
+Distribution*
+newDistribution(const std::string& familyString,
+                const AVector& responses,
+                const AVector& weights,
+                double phi)
+{
+    if (familyString == "binomial")
+    {
+        return new Binomial(responses,
+                            weights);
+    }
+    else if (familyString == "gaussian")
+    {
+        return new Gaussian(responses,
+                            weights,
+                            phi);
+    }
+    else if (familyString == "poisson")
+    {
+        return new Poisson(responses,
+                           weights);
+    }
+    else
+    {
+        Rcpp::stop("Distribution not implemented");
+    }
+}
@@ -13,6 +13,7 @@
 
 #include <types.h>
 #include <rcppExport.h>
+#include <string>
 
 
 // ***************************************************************************************************//
@@ -138,4 +139,14 @@ public:
 };
 
 
+// ***************************************************************************************************//
+
+// get a new distribution object for the family name, the responses, the weights and the
+// dispersion phi (only used by the Gaussian), which must be deleted by the caller
+Distribution*
+newDistribution(const std::string& familyString,
+                const AVector& responses,
+                const AVector& weights,
+                double phi);
+
 #endif /* DISTRIBUTIONS_H_ */
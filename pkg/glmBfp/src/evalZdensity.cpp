@@ -11,12 +11,38 @@
 #include <types.h>
 #include <zdensity.h>
 #include <fpUcHandling.h>
+#include <memoryUsage.h>
 #include <stdexcept>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace Rcpp;
 
 // ***************************************************************************************************//
 
+// compares indices by the z values they point to
+struct ZIndexComparator
+{
+    ZIndexComparator(const MyDoubleVector& zValues) :
+        zValues(zValues)
+        {}
+
+    bool
+    operator()(PosInt i, PosInt j) const
+    {
+        return zValues[i] < zValues[j];
+    }
+
+    const MyDoubleVector& zValues;
+};
+
+// ***************************************************************************************************//
+
 
 // R call is:
 //
@@ -64,16 +90,17 @@ cpp_evalZdensity(List rcpp_config, List rcpp_data, List rcpp_fpInfos, List rcpp_
 
     // data:
 
+    // (the Armadillo objects are views of the R memory, nothing is copied)
     const NumericMatrix n_x = rcpp_data["x"];
-    const AMatrix x(n_x.begin(), n_x.nrow(),
-                   n_x.ncol());
+    const AMatrix x = shareMatrix(n_x.begin(), n_x.nrow(),
+                                  n_x.ncol());
 
     const NumericMatrix n_xCentered = rcpp_data["xCentered"];
-    const AMatrix xCentered(n_xCentered.begin(), n_xCentered.nrow(),
-                           n_xCentered.ncol());
+    const AMatrix xCentered = shareMatrix(n_xCentered.begin(), n_xCentered.nrow(),
+                                          n_xCentered.ncol());
 
     const NumericVector n_y = rcpp_data["y"];
-    const AVector y(n_y.begin(), n_y.size());
+    const AVector y = shareVector(n_y.begin(), n_y.size());
 
     const IntVector censInd = as<IntVector>(rcpp_data["censInd"]);
 
@@ -125,6 +152,7 @@ cpp_evalZdensity(List rcpp_config, List rcpp_data, List rcpp_fpInfos, List rcpp_
     // options:
 
     const MyDoubleVector zValues = rcpp_options["zValues"];
+    const bool useOpenMP = as<bool>(rcpp_options["useOpenMP"]);
 //    const bool conditional = as<bool>(rcpp_options["conditional"]);
 //    const bool debug = as<bool>(rcpp_options["debug"]);
 //    const bool higherOrderCorrection = as<bool>(rcpp_options["higherOrderCorrection"]);
@@ -175,7 +203,7 @@ cpp_evalZdensity(List rcpp_config, List rcpp_data, List rcpp_fpInfos, List rcpp_
          maxUcDim += thisSize;
          ucSizes.push_back(thisSize);
      }
-     const UcInfo ucInfo(ucSizes, maxUcDim, ucIndices, ucColList);
+     const UcInfo ucInfo(ucSizes, maxUcDim, ucIndices, ucColList, xCentered);
 
      
      
@@ -208,21 +236,86 @@ cpp_evalZdensity(List rcpp_config, List rcpp_data, List rcpp_fpInfos, List rcpp_
      // evaluate the z density
      // ----------------------------------------------------------------------------------
 
-     // get negative log unnormalized z density: a function object.
-     NegLogUnnormZDens negLogUnnormZDens(thisModelConfig,
-                                         data,
-                                         fpInfo,
-                                         ucInfo,
-                                         fixInfo,
-                                         config,
-                                         bookkeep);
+     // visit the z values in increasing order, so that each IWLS run starts from the
+     // solution at the neighbouring z value (numerical continuation).
+     const PosInt nValues = zValues.size();
+     PosIntVector order(nValues);
+     for (PosInt i = 0; i != nValues; ++i)
+     {
+         order[i] = i;
+     }
+     std::sort(order.begin(), order.end(), ZIndexComparator(zValues));
+
+     // the sorted grid is split into contiguous chunks, each evaluated by its own function
+     // object (and thus Iwls object) in a separate thread. This only pays off for the
+     // generalised hyper-g approach and is only possible if the g prior does not call R.
+     // The higher order correction can stop or warn via R, so it is evaluated serially.
+     int nThreads = 1;
+#ifdef _OPENMP
+     if(useOpenMP && bookkeep.doGlm && (! bookkeep.tbf) && (! bookkeep.debug) &&
+        (! bookkeep.higherOrderCorrection) && config.gPrior->isThreadSafe())
+     {
+         nThreads = std::max(1, std::min(omp_get_num_procs(), static_cast<int>(nValues)));
+     }
+#endif
+
+     // preallocated results vector, written directly by the threads
+     NumericVector results(nValues);
+     double* resultsPtr = results.begin();
+
+     std::vector<std::string> errors(nThreads);
 
-     // evaluate it at the given z values.
-     NumericVector results;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nThreads)
+#endif
+     {
+         int thread = 0;
+#ifdef _OPENMP
+         thread = omp_get_thread_num();
+#endif
+         const PosInt begin = (thread * nValues) / nThreads;
+         const PosInt end = ((thread + 1) * nValues) / nThreads;
+
+         try
+         {
+             // get negative log unnormalized z density: a function object.
+             NegLogUnnormZDens negLogUnnormZDens(thisModelConfig,
+                                                 data,
+                                                 fpInfo,
+                                                 ucInfo,
+                                                 fixInfo,
+                                                 config,
+                                                 bookkeep);
+             negLogUnnormZDens.setWarnOnFailure(false);
+
+             // evaluate it at the z values of this chunk.
+             for (PosInt i = begin; i < end; ++i)
+             {
+                 resultsPtr[order[i]] = negLogUnnormZDens(zValues[order[i]]);
+             }
+         }
+         catch (std::exception& error)
+         {
+             errors[thread] = error.what();
+         }
+     }
+
+     // now we are back in the main thread and can talk to R
+     for (int thread = 0; thread != nThreads; ++thread)
+     {
+         if(! errors[thread].empty())
+         {
+             Rcpp::stop(errors[thread]);
+         }
+     }
 
-     for (MyDoubleVector::const_iterator z = zValues.begin(); z != zValues.end(); ++z)
+     for (PosInt i = 0; i != nValues; ++i)
      {
-         results.push_back(negLogUnnormZDens(* z));
+         if((! bookkeep.tbf) && ISNAN(resultsPtr[i]))
+         {
+             Rf_warning("for z=%f, the density value could not be computed for the following model:\n%s\nCheck for near-collinearity of covariates.",
+                        zValues[i], thisModelConfig.print(fpInfo).c_str());
+         }
      }
 
      // return the results vector
@@ -96,7 +96,7 @@ boxtidwell(double x, double power)
 // ***************************************************************************************************//
 
 // build array of vectors of AVectors holding the required transformed values for the design matrices
-// do not! center the column. This is done inside getFpMatrix, because the repeated powers case cannot
+// do not! center the column. This is done inside getFpBasis, because the repeated powers case cannot
 // be treated here!!
 AVectorArray
 getTransformedCols(const PosIntVector& fpcards,
@@ -153,6 +153,116 @@ getTransformedCols(const PosIntVector& fpcards,
 
 // ***************************************************************************************************//
 
+// build the cache of all centered FP basis columns
+std::vector<AMatrix>
+getFpBasis(const PosIntVector& fpcards,
+           const PosIntVector& fppos,
+           const PosIntVector& fpmaxs,
+           const AMatrix& x)
+{
+    const AVectorArray tcols = getTransformedCols(fpcards, fppos, fpmaxs, x);
+
+    std::vector<AMatrix> basis;
+
+    for (PosInt i = 0; i != fpcards.size(); ++i)
+    {
+        const PosInt card = fpcards[i];
+        const AVector logCol = arma::log(x.col(fppos[i] - 1));
+
+        AMatrix thisBasis(x.n_rows, card * fpmaxs[i]);
+
+        // a repeated power is multiplied once more with the log column, which also covers
+        // the repeated log power because the log column itself is its first level.
+        for (PosInt j = 0; j != card; ++j)
+        {
+            AVector thisLevel = tcols[i][j];
+            for (PosInt repeat = 0; repeat != fpmaxs[i]; ++repeat)
+            {
+                if (repeat > 0)
+                {
+                    thisLevel %= logCol;
+                }
+                thisBasis.col(repeat * card + j) = thisLevel - arma::mean(thisLevel);
+            }
+        }
+
+        basis.push_back(thisBasis);
+    }
+
+    return basis;
+}
+
+// ***************************************************************************************************//
+
+// get the factor coding of the columns cols (1-based) of the centered design matrix
+FactorCoding
+getFactorCoding(const AMatrix& xCentered,
+                const PosIntVector& cols)
+{
+    FactorCoding ret;
+
+    const PosInt nCols = cols.size();
+    if(nCols < 2)
+    {
+        return ret;
+    }
+
+    const PosInt nObs = xCentered.n_rows;
+
+    // the two values of each column
+    AVector low(nCols);
+    AVector high(nCols);
+    for(PosInt j = 0; j != nCols; ++j)
+    {
+        const double* col = xCentered.colptr(cols[j] - 1);
+        low(j) = high(j) = col[0];
+        for(PosInt i = 1; i != nObs; ++i)
+        {
+            if(col[i] != low(j) && col[i] != high(j))
+            {
+                if(low(j) != high(j))
+                {
+                    return ret; // a third value
+                }
+                (col[i] < low(j) ? low(j) : high(j)) = col[i];
+            }
+        }
+        if(low(j) == high(j))
+        {
+            return ret; // a constant column
+        }
+    }
+
+    // the level codes: at most one column may be at its larger value
+    PosIntVector codes(nObs, 0);
+    for(PosInt j = 0; j != nCols; ++j)
+    {
+        const double* col = xCentered.colptr(cols[j] - 1);
+        for(PosInt i = 0; i != nObs; ++i)
+        {
+            if(col[i] == high(j))
+            {
+                if(codes[i] != 0)
+                {
+                    return ret;
+                }
+                codes[i] = j + 1;
+            }
+        }
+    }
+
+    ret.codes = codes;
+    ret.levelValues = arma::repmat(arma::trans(low), nCols + 1, 1);
+    for(PosInt j = 0; j != nCols; ++j)
+    {
+        ret.levelValues(j + 1, j) = high(j);
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
 
 // convert frequency vector into multiset
 Powers
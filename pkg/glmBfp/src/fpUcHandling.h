@@ -9,8 +9,10 @@
 #define FPUCHANDLING_H_
 
 #include <types.h>
+#include <algorithm>
 #include <numeric>
 #include <rcppExport.h>
+#include <rngStreams.h>
 
 // ***************************************************************************************************//
 
@@ -22,7 +24,7 @@ getMaxPowerSet(const PosIntVector& fpmaxs);
 // ***************************************************************************************************//
 
 // build array of vectors of ColumnVectors holding the required transformed values for the design matrices
-// do not! center the column. This is done inside getFpMatrix, because the repeated powers case cannot
+// do not! center the column. This is done inside getFpBasis, because the repeated powers case cannot
 // be treated here.
 AVectorArray
 getTransformedCols(const PosIntVector& fpcards,
@@ -33,6 +35,17 @@ getTransformedCols(const PosIntVector& fpcards,
 
 // ***************************************************************************************************//
 
+// build the cache of all centered FP basis columns, one contiguous matrix per FP:
+// column (repeat * fpcards[i] + powerInd) of the i-th matrix is the transform with
+// power index powerInd, multiplied "repeat" times with the log column, and centered.
+std::vector<AMatrix>
+getFpBasis(const PosIntVector& fpcards,
+           const PosIntVector& fppos,
+           const PosIntVector& fpmaxs,
+           const AMatrix& x);
+
+// ***************************************************************************************************//
+
 
 struct FpInfo
 { // collects all information on fractional polynomials needed to be passed down
@@ -42,9 +55,18 @@ struct FpInfo
     PosIntVector fppos;
     PosIntVector fpmaxs;
     StrVector fpnames;
-    AVectorArray tcols;
+    std::vector<AMatrix> basis;
     PosInt maxFpDim;
 
+    // are the basis cache and the design matrices of the IWLS stored in single precision?
+    // Then basisSingle replaces basis, which is empty. All sums are still accumulated
+    // in double precision.
+    bool singlePrecision;
+    std::vector<SMatrix> basisSingle;
+
+    // number of observations
+    PosInt nObs;
+
     // number of possible univariate fps for each FP?
     IntVector numberPossibleFps;
 
@@ -57,13 +79,27 @@ struct FpInfo
            const PosIntVector& fppos,
            const PosIntVector& fpmaxs,
            const StrVector& fpnames,
-           const AMatrix& x) :
+           const AMatrix& x,
+           bool singlePrecision = false) :
         nFps(fpmaxs.size()), powerset(getMaxPowerSet(fpmaxs)), fpcards(fpcards),
-                fppos(fppos), fpmaxs(fpmaxs), fpnames(fpnames), tcols(getTransformedCols(fpcards, fppos, fpmaxs, x)),
+                fppos(fppos), fpmaxs(fpmaxs), fpnames(fpnames), basis(getFpBasis(fpcards, fppos, fpmaxs, x)),
                 maxFpDim(std::accumulate(fpmaxs.begin(), fpmaxs.end(), 0)),
+                singlePrecision(singlePrecision),
+                basisSingle(),
+                nObs(x.n_rows),
                 numberPossibleFps(),
                 linearPowers()
     {
+        // convert the basis cache, one FP at a time
+        if(singlePrecision)
+        {
+            for(PosInt i = 0; i != nFps; ++i)
+            {
+                basisSingle.push_back(arma::conv_to<SMatrix>::from(basis[i]));
+                basis[i].reset();
+            }
+        }
+
         // numbers of possible univariate fps?
         for(PosInt i=0; i != nFps; ++i)
         {
@@ -88,10 +124,69 @@ struct FpInfo
     Powers
     vec2inds(const MyDoubleVector& p) const;
 
+    // copy the cached column of FP i for power index powerInd at the given repeat level
+    // (0 for the first occurrence of a power, 1 for the first repetition etc.) to out
+    void
+    copyBasisColumn(PosInt i, PosInt powerInd, PosInt repeat, double* out) const
+    {
+        if(repeat >= fpmaxs.at(i))
+        {
+            Rcpp::stop("FpInfo::copyBasisColumn: power repeated more often than the maximum degree allows");
+        }
+
+        const PosInt col = repeat * fpcards[i] + powerInd;
+        if(singlePrecision)
+        {
+            const float* source = basisSingle.at(i).colptr(col);
+            std::copy(source, source + nObs, out);
+        }
+        else
+        {
+            const double* source = basis.at(i).colptr(col);
+            std::copy(source, source + nObs, out);
+        }
+    }
+
 };
 
 // ***************************************************************************************************//
 
+// level code form of a group of (possibly centered) dummy columns of a factor:
+// the design matrix columns of the group equal E * levelValues, where E is the
+// indicator matrix of the level codes. Row 0 of levelValues holds the values of the
+// reference level, and row j + 1 the values of the level with dummy column j.
+struct FactorCoding
+{
+    // the level code of each observation
+    PosIntVector codes;
+
+    // nLevels x nColumns matrix of the column values for each level
+    AMatrix levelValues;
+
+    // is the group a factor at all?
+    bool
+    isFactor() const
+    {
+        return ! codes.empty();
+    }
+
+    PosInt
+    nLevels() const
+    {
+        return levelValues.n_rows;
+    }
+};
+
+// get the factor coding of the columns cols (1-based) of the centered design matrix,
+// if each column takes exactly two values and each observation has at most one column at
+// its larger value. Otherwise (and for single columns, where nothing is saved)
+// the returned coding is empty.
+FactorCoding
+getFactorCoding(const AMatrix& xCentered,
+                const PosIntVector& cols);
+
+// ***************************************************************************************************//
+
 // collects all information on uncertain fixed form covariates groups
 struct UcInfo
 {
@@ -101,13 +196,33 @@ struct UcInfo
     const std::vector <PosIntVector> ucColList;
     const PosInt nUcGroups;
 
+    // the factor codings of the groups (empty for groups which are no factors)
+    std::vector<FactorCoding> ucFactors;
+
+    // the (1-based) groups with s columns are ucGroupsBySize[s], so that the free groups
+    // in the model search can be updated only for the sizes where the fit changes
+    std::vector<PosIntVector> ucGroupsBySize;
+
     UcInfo(const PosIntVector& ucSizes,
            const PosInt maxUcDim,
            const PosIntVector& ucIndices,
-           const std::vector<PosIntVector>& ucColList) :
+           const std::vector<PosIntVector>& ucColList,
+           const AMatrix& xCentered) :
         ucSizes(ucSizes), maxUcDim(maxUcDim), ucIndices(ucIndices),
-                ucColList(ucColList), nUcGroups(ucColList.size())
+                ucColList(ucColList), nUcGroups(ucColList.size()),
+                ucFactors(), ucGroupsBySize()
     {
+        for(PosInt i = 0; i != nUcGroups; ++i)
+        {
+            ucFactors.push_back(getFactorCoding(xCentered, ucColList[i]));
+        }
+
+        for(PosInt i = 1; i <= ucSizes.size(); ++i)
+        {
+            if(ucGroupsBySize.size() <= ucSizes[i - 1])
+                ucGroupsBySize.resize(ucSizes[i - 1] + 1);
+            ucGroupsBySize[ucSizes[i - 1]].push_back(i);
+        }
     }
 };
 
@@ -136,16 +251,17 @@ struct FixInfo
 
 
 // return iterator of random element of myset; should be enclosed in getRNGstate() etc.
+// for the legacy stream
 template<class T>
     typename T::iterator
-    discreteUniform(const T& container)
+    discreteUniform(const T& container, RngStream& rng)
     {
         if (container.empty())
         {
             Rcpp::stop("\ncontainer in call to discreteUniform is empty!\n");
         }
 
-        double u = unif_rand();
+        double u = rng.unif();
 
         typename T::size_type size = container.size();
         typename T::const_iterator i = container.begin();
@@ -163,9 +279,10 @@ template<class T>
 // ***************************************************************************************************//
 
 // get random int x with lower <= x < upper; should be enclosed in getRNGstate() etc.
+// for the legacy stream
 template<class INT>
 INT
-discreteUniform(const INT& lower, const INT& upper)
+discreteUniform(const INT& lower, const INT& upper, RngStream& rng)
 {
     if (lower >= upper)
     {
@@ -173,7 +290,7 @@ discreteUniform(const INT& lower, const INT& upper)
                  upper);
     }
 
-    double u = unif_rand();
+    double u = rng.unif();
 
     INT size = upper - lower;
     INT ret = lower;
@@ -189,44 +306,6 @@ discreteUniform(const INT& lower, const INT& upper)
 // ***************************************************************************************************//
 
 
-// delete a number from a set
-template<class T>
-    typename std::set<T>
-    removeElement(std::set<T> input, T element)
-    {
-        typename std::set<T>::iterator iter = input.begin();
-        while (iter != input.end())
-        {
-            if (*iter == element)
-                // A copy of iter is passed into erase(), ++ is executed after erase().
-                // Thus iter remains valid
-                input.erase(iter++);
-            else
-                ++iter;
-        }
-
-        return input;
-    }
-
-// ***************************************************************************************************//
-
-// construct a sequence 1:maximum
-template<class T>
-    typename std::set<T>
-    constructSequence(T maximum)
-    {
-        std::set<T> ret;
-
-        for (T i = 1; i <= maximum; ++i)
-        {
-            ret.insert(ret.end(), i);
-        }
-
-        return ret;
-    }
-
-// ***************************************************************************************************//
-
 // convert frequency vector into multiset
 Powers
 freqvec2Powers(IntVector& vec, const int &vecLength);
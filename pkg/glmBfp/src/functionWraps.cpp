@@ -7,6 +7,8 @@
 
 #include <functionWraps.h>
 #include <rcppExport.h>
+#include <algorithm>
+#include <set>
 
 using namespace Rcpp;
 
@@ -162,20 +164,120 @@ VectorRFunction::operator()(const double* vector) const
 
 // ***************************************************************************************************//
 
+// orders indices by the arguments, and compares them with argument values
+struct ArgLess
+{
+    ArgLess(const MyDoubleVector& args) : args(args) {}
+
+    bool
+    operator()(PosInt i, PosInt j) const
+    {
+        return args[i] < args[j];
+    }
+
+    bool
+    operator()(PosInt i, double arg) const
+    {
+        return args[i] < arg;
+    }
+
+    bool
+    operator()(double arg, PosInt i) const
+    {
+        return arg < args[i];
+    }
+
+    const MyDoubleVector& args;
+};
+
 // save one pair of argument and function value
 void
 Cache::save(double arg, double val)
 {
+    if(compacted)
+    {
+        Rcpp::stop("cannot save into a compacted Cache");
+    }
+
+    // insert the new index after all equal arguments
+    order.insert(std::upper_bound(order.begin(), order.end(), arg, ArgLess(args)),
+                 args.size());
+
     args.push_back(arg);
     vals.push_back(val);
 }
 
+// compact the cache
+void
+Cache::compact(PosInt maxPoints)
+{
+    if(compacted)
+        return;
+
+    // the indices of the pairs with finite values, ordered by the arguments
+    PosIntVector order;
+    for(PosInt i = 0; i != args.size(); ++i)
+    {
+        if(R_finite(vals[i]))
+            order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), ArgLess(args));
+    const PosInt n = order.size();
+
+    // the selected ranks: at least both ends and the mode are kept
+    maxPoints = std::max(maxPoints, static_cast<PosInt>(3));
+    std::set<PosInt> ranks;
+    if(n <= maxPoints)
+    {
+        for(PosInt r = 0; r != n; ++r)
+            ranks.insert(r);
+    }
+    else
+    {
+        // the rank of the smallest function value, i.e. the mode of the density
+        PosInt modeRank = 0;
+        for(PosInt r = 1; r != n; ++r)
+        {
+            if(vals[order[r]] < vals[order[modeRank]])
+                modeRank = r;
+        }
+
+        ranks.insert(0);
+        ranks.insert(n - 1);
+        ranks.insert(modeRank);
+
+        // and fill up with evenly spread ranks
+        for(PosInt k = 1; (k + 1 < maxPoints) && (ranks.size() < maxPoints); ++k)
+        {
+            ranks.insert(static_cast<PosInt>((n - 1.0) * k / (maxPoints - 1.0) + 0.5));
+        }
+    }
+
+    compactArgs.clear();
+    compactVals.clear();
+    for(std::set<PosInt>::const_iterator r = ranks.begin(); r != ranks.end(); ++r)
+    {
+        compactArgs.push_back(static_cast<float>(args[order[*r]]));
+        compactVals.push_back(static_cast<float>(vals[order[*r]]));
+    }
+
+    // free the memory of the full cache
+    MyDoubleVector().swap(args);
+    MyDoubleVector().swap(vals);
+    PosIntVector().swap(order);
+    compacted = true;
+}
+
 // clear the cache
 void
 Cache::clear()
 {
     args.clear();
     vals.clear();
+    order.clear();
+    compactArgs.clear();
+    compactVals.clear();
+    compacted = false;
 }
 
 // query for a function value
@@ -183,32 +285,61 @@ double
 Cache::getValue(double arg) const
 {
     // search for the argument
-    MyDoubleVector::const_iterator iterVals = vals.begin();
-    for(MyDoubleVector::const_iterator
-            iterArgs = args.begin();
-            iterArgs != args.end();
-            ++iterArgs, ++iterVals)
+    PosIntVector::const_iterator pos = std::lower_bound(order.begin(), order.end(), arg, ArgLess(args));
+
+    // match -> return corresponding value.
+    if((pos != order.end()) && (args[*pos] == arg))
     {
-        // match -> return corresponding value.
-        if(*iterArgs == arg)
-        {
-            return *iterVals;
-        }
+        return vals[*pos];
     }
 
     // if we have not found the argument, return NA
     return R_NaReal;
 }
 
+// get the pairs near an argument
+PosInt
+Cache::getNeighbours(double arg,
+                     double radius,
+                     MyDoubleVector& neighbourArgs,
+                     MyDoubleVector& neighbourVals) const
+{
+    neighbourArgs.clear();
+    neighbourVals.clear();
+
+    for(PosIntVector::const_iterator
+            pos = std::lower_bound(order.begin(), order.end(), arg - radius, ArgLess(args));
+            (pos != order.end()) && (args[*pos] <= arg + radius);
+            ++pos)
+    {
+        if(R_finite(vals[*pos]))
+        {
+            neighbourArgs.push_back(args[*pos]);
+            neighbourVals.push_back(vals[*pos]);
+        }
+    }
+
+    return neighbourArgs.size();
+}
+
 // initialize from an R list
 Cache::Cache(List& rcpp_list) :
         args(as<MyDoubleVector>(rcpp_list["args"])),
-        vals(as<MyDoubleVector>(rcpp_list["vals"]))
+        vals(as<MyDoubleVector>(rcpp_list["vals"])),
+        compacted(false)
 {
     if(args.size() != vals.size())
     {
         Rcpp::stop("Lengths of args and vals vectors in R list converted to Cache object not equal!");
     }
+
+    // build the index of the arguments
+    order.resize(args.size());
+    for(PosInt i = 0; i != args.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), ArgLess(args));
 }
 
 // convert to an Rcpp list
@@ -10,6 +10,8 @@
 
 #include <rcppExport.h>
 #include <types.h>
+#include <perfCounters.h>
+#include <vector>
 
 // ***************************************************************************************************//
 
@@ -63,7 +65,11 @@ private:
 
 // ***************************************************************************************************//
 
-// simple function value cache
+// simple function value cache.
+// The arguments are kept in an index ordered by their values, so that a function value
+// and the evaluations near an argument are found by binary search.
+// It can be compacted to a few points in single precision, which is enough for the
+// marginal z density approximation, when many of them must be kept in memory.
 class Cache
 {
 public:
@@ -75,14 +81,27 @@ public:
     MyDoubleVector
     getArgs() const
     {
-        return args;
+        return compacted ? MyDoubleVector(compactArgs.begin(), compactArgs.end()) : args;
     }
 
     // extract the function values
     MyDoubleVector
     getVals() const
     {
-        return vals;
+        return compacted ? MyDoubleVector(compactVals.begin(), compactVals.end()) : vals;
+    }
+
+    // keep at most maxPoints pairs with finite function values, in single precision.
+    // The kept arguments are evenly spread over the ranks of all arguments, including the
+    // smallest and the largest one and the argument with the smallest function value.
+    // Afterwards no more pairs can be saved.
+    void
+    compact(PosInt maxPoints);
+
+    bool
+    isCompact() const
+    {
+        return compacted;
     }
 
     // clear the cache
@@ -93,11 +112,19 @@ public:
     double
     getValue(double arg) const;
 
+    // get the pairs with finite function values and arguments in [arg - radius, arg + radius],
+    // ordered by the arguments. Returns the number of pairs.
+    PosInt
+    getNeighbours(double arg,
+                  double radius,
+                  MyDoubleVector& neighbourArgs,
+                  MyDoubleVector& neighbourVals) const;
+
     // initialize from an R list
     Cache(Rcpp::List& rcpp_list);
 
     // default ctr is allowed as well
-    Cache(){};
+    Cache() : compacted(false) {};
 
     // convert to an R list
     Rcpp::List
@@ -106,6 +133,14 @@ public:
 private:
     MyDoubleVector args;
     MyDoubleVector vals;
+
+    // the indices of args in increasing order of the arguments
+    PosIntVector order;
+
+    // the compact representation
+    bool compacted;
+    std::vector<float> compactArgs;
+    std::vector<float> compactVals;
 };
 
 // ***************************************************************************************************//
@@ -122,7 +157,7 @@ template<class Fun>
         }
 
         // return the cached values
-        Cache
+        const Cache&
         getCache() const
         {
             return cache;
@@ -249,6 +284,55 @@ template<class Fun>
     };
 // ***************************************************************************************************//
 
+// get the inverse second derivative of a cached function with as few new evaluations as
+// possible: first a local polynomial fit of the cached evaluations near the argument is tried.
+// If these are too few or the fit is not accurate enough, second differences with halved step
+// sizes are extrapolated (Ridders), until the error estimate is small enough.
+// Fun must be a CachedFunction.
+template<class Fun>
+    class AdaptiveNumericInvHessian
+    {
+    public:
+        // save the function (object) reference, the start step size and the relative
+        // tolerance for the second derivative
+        AdaptiveNumericInvHessian(Fun& function,
+                                  double eps = 0.1,
+                                  double tolerance = 1e-4) :
+            function(function),
+            h(eps),
+            tolerance(tolerance),
+            ntab(10),
+            safe(2.0)
+        {
+            if(eps <= 0)
+            {
+                Rcpp::stop("eps must be positive in AdaptiveNumericInvHessian");
+            }
+        }
+
+        // for use as a function
+        double
+        operator()(double x) const;
+
+    private:
+        // the second derivative from the local fit of the cached evaluations,
+        // or NA if that is not possible or not accurate enough
+        double
+        localFit(double x) const;
+
+        Fun& function;
+        const double h;
+        const double tolerance;
+
+        // sets maximum size of tableau
+        const int ntab;
+
+        // return when error is safe worse than the best so far
+        const double safe;
+    };
+
+// ***************************************************************************************************//
+
 // for use as a function
 template <class Fun>
 double
@@ -259,10 +343,16 @@ CachedFunction<Fun>::operator()(double x)
     // if not found in the old arguments
     if(R_IsNA(ret))
     {
+        perfCounters.increment(PerfCounters::zCacheMisses);
+
         // we have to compute and save it.
         ret = function(x);
         cache.save(x, ret);
     }
+    else
+    {
+        perfCounters.increment(PerfCounters::zCacheHits);
+    }
 
     // finally return the value (either found or newly computed)
     return ret;
@@ -393,4 +483,133 @@ AccurateNumericInvHessian<Fun>::operator()(double x) const
 
 // ***************************************************************************************************//
 
+// the second derivative from the local fit of the cached evaluations
+template <class Fun>
+double
+AdaptiveNumericInvHessian<Fun>::localFit(double x) const
+{
+    MyDoubleVector args;
+    MyDoubleVector vals;
+    function.getCache().getNeighbours(x, h, args, vals);
+
+    // take the points which are not too close to x, because there the differences
+    // are dominated by the error of the function values, and x itself
+    const double minSpacing = h / 16.0;
+    MyDoubleVector dists;
+    MyDoubleVector fitVals;
+    PosInt nBelow = 0;
+    PosInt nAbove = 0;
+    for(PosInt i = 0; i != args.size(); ++i)
+    {
+        const double dist = args[i] - x;
+        if((dist == 0.0) || (fabs(dist) >= minSpacing))
+        {
+            dists.push_back(dist / h);
+            fitVals.push_back(vals[i]);
+            nBelow += (dist < 0.0);
+            nAbove += (dist > 0.0);
+        }
+    }
+
+    // we need two points on each side, so that the quadratic and the cubic fit can be compared
+    if((nBelow < 2) || (nAbove < 2) || (dists.size() < 5))
+    {
+        return R_NaReal;
+    }
+
+    // least squares fits of the polynomials in the scaled distances
+    const PosInt n = dists.size();
+    AMatrix basis(n, 4);
+    AVector response(n);
+    for(PosInt i = 0; i != n; ++i)
+    {
+        basis(i, 0) = 1.0;
+        basis(i, 1) = dists[i];
+        basis(i, 2) = dists[i] * dists[i];
+        basis(i, 3) = basis(i, 2) * dists[i];
+        response(i) = fitVals[i];
+    }
+
+    AVector quadratic;
+    AVector cubic;
+    if(! (arma::solve(quadratic, basis.cols(0, 2), response) &&
+          arma::solve(cubic, basis, response)))
+    {
+        return R_NaReal;
+    }
+
+    const double quadraticEstimate = 2.0 * quadratic(2) / (h * h);
+    const double cubicEstimate = 2.0 * cubic(2) / (h * h);
+
+    return (fabs(quadraticEstimate - cubicEstimate) <= tolerance * fabs(cubicEstimate)) ?
+            cubicEstimate : R_NaReal;
+}
+
+// ***************************************************************************************************//
+
+// for use as a function
+template <class Fun>
+double
+AdaptiveNumericInvHessian<Fun>::operator()(double x) const
+{
+    // first try the cached evaluations
+    const double fitted = localFit(x);
+    if(! R_IsNA(fitted))
+    {
+        return 1.0 / fitted;
+    }
+
+    // otherwise the Ridders tableau of the central second differences, where the step size is
+    // halved in each column. Because the error expansion is in even powers of the step size,
+    // the extrapolation factor is 4.
+    const double fx = function(x);
+
+    double hh = h;
+    double err = DBL_MAX;
+
+    std::vector<MyDoubleVector> a (ntab, MyDoubleVector (ntab, 0));
+
+    a[0][0] = (function(x + hh) - 2.0 * fx + function(x - hh)) / (hh * hh);
+
+    double answer = a[0][0];
+
+    for (int i = 1; i < ntab; i++)
+    {
+        hh /= 2.0;
+
+        a[0][i] = (function(x + hh) - 2.0 * fx + function(x - hh)) / (hh * hh);
+
+        double fac = 4.0;
+
+        for (int j = 1; j <= i; j++)
+        {
+            a[j][i] = (a[j-1][i] * fac - a[j-1][i-1]) / (fac - 1.0);
+
+            fac = 4.0 * fac;
+
+            double errt = fmax(fabs(a[j][i] - a[j-1][i]),
+                               fabs(a[j][i] - a[j-1][i-1]));
+
+            if (errt <= err)
+            {
+                err = errt;
+                answer = a[j][i];
+            }
+        }
+
+        // accurate enough? Usually this is the case after the first extrapolation, so that
+        // only 5 function evaluations are needed.
+        if (err <= tolerance * fabs(answer))
+            break;
+
+        // If higher order is worse by a significant factor safe, then quit early.
+        if (fabs(a[i][i] - a[i-1][i-1]) >= safe * err)
+            break;
+    }
+
+    return 1.0 / answer;
+}
+
+// ***************************************************************************************************//
+
 #endif /* FUNCTIONWRAPS_H_ */
@@ -6,6 +6,12 @@
 #include <bfgs.h>
 #include <optimize.h>
 #include <fpUcHandling.h>
+#include <memoryUsage.h>
+#include <rngStreams.h>
+#include <modelProposal.h>
+#include <checkpoint.h>
+#include <modelStore.h>
+#include <perfCounters.h>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -23,6 +29,7 @@
 #include <sstream>
 #include <string>
 #include <stdexcept>
+#include <chrono>
 
 // using pretty much:
 using std::map;
@@ -53,7 +60,14 @@ getGlmVarLogMargLik(const ModelPar &mod,
                     double& zMode,
                     double& zVar,
                     double& laplaceApprox,
-                    double& residualDeviance)
+                    double& residualDeviance,
+                    // optional start linear predictor for the IWLS, which is
+                    // overwritten with the linear predictor near the mode of this model
+                    AVector* linPredWarmStart=0,
+                    // if the Laplace approximation is below this bound, the model is
+                    // negligible and the quadrature is skipped, which is flagged here
+                    double laplaceOnlyBound=R_NegInf,
+                    bool* laplaceOnly=0)
 {
     // echo detailed progress in debug mode
     if(bookkeep.debug)
@@ -64,6 +78,8 @@ getGlmVarLogMargLik(const ModelPar &mod,
     // check if any interrupt signals have been entered
     R_CheckUserInterrupt();
 
+    PhaseTimer timer(PerfCounters::margLikPhase);
+
     // the return value will be placed in here:
     double ret = 0.0;
 
@@ -77,7 +93,8 @@ getGlmVarLogMargLik(const ModelPar &mod,
                                             ucInfo,
                                             fixInfo,
                                             config,
-                                            bookkeep);
+                                            bookkeep,
+                                            linPredWarmStart);
         residualDeviance = negLogUnnormZDens.getResidualDeviance();
 
         // try to ask for analytic solutions in the TBF case
@@ -152,6 +169,8 @@ getGlmVarLogMargLik(const ModelPar &mod,
         }
         else if(bookkeep.empiricalBayes)
         {
+            PhaseTimer optimizationTimer(PerfCounters::optimizationPhase);
+
             // construct an appropriate object for using the optimize routine
             Brent<CachedFunction<NegLogUnnormZDens> > brent(cachedNegLogUnnormZDens,
                                                             -20,//-100.0, // log(DBL_MIN) + 40.0,
@@ -179,8 +198,12 @@ getGlmVarLogMargLik(const ModelPar &mod,
         }
         else // start full Bayes
         {
-            // get function invHess to compute an accurate variance estimate
-            AccurateNumericInvHessian<CachedFunction<NegLogUnnormZDens> > invHess(cachedNegLogUnnormZDens);
+            // get function invHess to compute an accurate variance estimate,
+            // which reuses the evaluations of the optimization where possible
+            AdaptiveNumericInvHessian<CachedFunction<NegLogUnnormZDens> > invHess(cachedNegLogUnnormZDens);
+
+            // the optimization phase ends with the variance estimate
+            PhaseTimer optimizationTimer(PerfCounters::optimizationPhase);
 
             // decide if bfgs, or optimize should be used
             if(bookkeep.useBfgs)
@@ -230,6 +253,7 @@ getGlmVarLogMargLik(const ModelPar &mod,
                 // use the same epsilon here as for the minimization routine.
                 zVar = invHess(zMode);
             }
+            optimizationTimer.stop();
 
             // be careful that the result for zVar is not totally wrong.
             // if the variance estimate is very large, warn the user.
@@ -263,29 +287,61 @@ getGlmVarLogMargLik(const ModelPar &mod,
             laplaceApprox = M_LN_SQRT_2PI + 0.5 * log(zVar) - cachedNegLogUnnormZDens(zMode);
             // so this does not require evaluations inside the Gauss-Hermite quadrature.
 
-            // then compute the Gauss-Hermite quadrature, using the supplied standard nodes and
-            // weights from R
-            MyDoubleVector nodes;
-            MyDoubleVector logWeights;
+            if(laplaceApprox < laplaceOnlyBound)
+            {
+                // the model is negligible anyway, so the Laplace approximation suffices
+                ret = laplaceApprox;
+                if(laplaceOnly)
+                {
+                    *laplaceOnly = true;
+                }
 
-            // get the nodes and log weights for this mode and variance:
-            gaussHermite.getNodesAndLogWeights(zMode, zVar, nodes, logWeights);
+                if(bookkeep.debug)
+                {
+                    Rprintf("\ngetGlmVarLogMargLik: negligible model, only using the Laplace approximation");
+                }
+            }
+            else
+            {
+                PhaseTimer quadratureTimer(PerfCounters::quadraturePhase);
 
-            // the log contributions which will be stored here:
-            SafeSum logContributions;
+                // then compute the Gauss-Hermite quadrature, using the supplied standard nodes and
+                // weights from R. With a quadrature tolerance, the rules of increasing orders are
+                // used until two successive ones agree, otherwise only the full rule.
+                const PosInt lastRule = gaussHermite.nRules() - 1;
+                const PosInt firstRule = (bookkeep.quadratureTolerance > 0.0) ? 0 : lastRule;
 
-            // compute them now
-            MyDoubleVector::const_iterator n = nodes.begin();
-            for(MyDoubleVector::const_iterator
-                    w = logWeights.begin();
-                    w != logWeights.end();
-                    ++w, ++n)
-            {
-                logContributions.add((*w) - cachedNegLogUnnormZDens(*n));
-            }
+                for(PosInt rule = firstRule; rule <= lastRule; ++rule)
+                {
+                    MyDoubleVector nodes;
+                    MyDoubleVector logWeights;
+
+                    // get the nodes and log weights for this mode and variance:
+                    gaussHermite.getNodesAndLogWeights(zMode, zVar, nodes, logWeights, rule);
+
+                    // the log contributions which will be stored here:
+                    SafeSum logContributions;
+
+                    // compute them now
+                    MyDoubleVector::const_iterator n = nodes.begin();
+                    for(MyDoubleVector::const_iterator
+                            w = logWeights.begin();
+                            w != logWeights.end();
+                            ++w, ++n)
+                    {
+                        logContributions.add((*w) - cachedNegLogUnnormZDens(*n));
+                    }
+
+                    // the result is the log of the sum of the exp'ed values
+                    const double lowerOrderRet = ret;
+                    ret = logContributions.logSumExp();
 
-            // the result is the log of the sum of the exp'ed values
-            ret = logContributions.logSumExp();
+                    if((rule > firstRule) && (fabs(ret - lowerOrderRet) <= bookkeep.quadratureTolerance))
+                    {
+                        break;
+                    }
+                }
+            }
         } // end full Bayes
 
         // echo detailed progress in debug mode
@@ -297,6 +353,12 @@ getGlmVarLogMargLik(const ModelPar &mod,
         // also give back the cache
         cache = cachedNegLogUnnormZDens.getCache();
 
+        // and the linear predictor as warm start for the next model
+        if(linPredWarmStart && ! negLogUnnormZDens.getModeLinPred().is_empty())
+        {
+            *linPredWarmStart = negLogUnnormZDens.getModeLinPred();
+        }
+
         // check finiteness
         if (! R_finite(ret))
         {
@@ -410,7 +472,9 @@ computeGlm(const ModelPar &mod,
            const FixInfo& fixInfo,
            Book& bookkeep,
            const GlmModelConfig& config,
-           const GaussHermite& gaussHermite)
+           const GaussHermite& gaussHermite,
+           ModelStore& store,
+           AVector* linPredWarmStart=0) // optional warm start for the IWLS, see getGlmVarLogMargLik
 {
     // log prior
     const double thisLogPrior = getVarLogPrior(mod,
@@ -427,6 +491,7 @@ computeGlm(const ModelPar &mod,
     double zVar = R_NaReal;
     double laplaceApprox = R_NaReal;
     double residualDeviance = R_NaReal;
+    bool laplaceOnly = false;
     Cache cache;
 
     // compute log marginal likelihood, and also as byproducts unnormalized z density information.
@@ -436,10 +501,28 @@ computeGlm(const ModelPar &mod,
     {
         thisVarLogMargLik = config.nullModelLogMargLik;
     }
+    else if(const GlmModelInfo* stored = store.find(mod)) // computed in an earlier run
+    {
+        thisVarLogMargLik = stored->logMargLik;
+        cache = stored->negLogUnnormZDensities;
+        zMode = stored->zMode;
+        zVar = stored->zVar;
+        laplaceApprox = stored->laplaceApprox;
+        residualDeviance = stored->residualDeviance;
+    }
     else // not the null model, so at least one other coefficient than the intercept present in the model
     {
         thisVarLogMargLik = getGlmVarLogMargLik(mod, data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite,
-                                                cache, zMode, zVar, laplaceApprox, residualDeviance);
+                                                cache, zMode, zVar, laplaceApprox, residualDeviance,
+                                                linPredWarmStart, bookkeep.laplaceOnlyBound(thisLogPrior),
+                                                &laplaceOnly);
+
+        // (Laplace-only models are not stored, because later searches may need them in full)
+        if ((R_IsNaN(thisVarLogMargLik) == FALSE) && ! laplaceOnly)
+        {
+            store.add(mod, GlmModelInfo(thisVarLogMargLik, R_NaReal, cache, zMode, zVar, laplaceApprox,
+                                        residualDeviance));
+        }
     }
 
     // if we get back NaN
@@ -451,8 +534,15 @@ computeGlm(const ModelPar &mod,
     }
     else
     {
+        // keep only a compact z density cache if requested
+        if(bookkeep.zCachePoints > 0)
+        {
+            cache.compact(bookkeep.zCachePoints);
+        }
+
         // put all into the modelInfo
-        GlmModelInfo info(thisVarLogMargLik, thisLogPrior, cache, zMode, zVar, laplaceApprox, residualDeviance);
+        GlmModelInfo info(thisVarLogMargLik, thisLogPrior, cache, zMode, zVar, laplaceApprox, residualDeviance,
+                          laplaceOnly);
 
         // altogether we have the model:
         Model thisModel(mod, info);
@@ -475,6 +565,8 @@ computeGlm(const ModelPar &mod,
         // compute log posterior probability (up to an additive constant) and
         // append it to the safe sum object
         bookkeep.modelLogPosteriors.add(thisVarLogMargLik + thisLogPrior);
+        bookkeep.maxLogPosterior = std::max(bookkeep.maxLogPosterior, thisVarLogMargLik + thisLogPrior);
+        bookkeep.laplaceOnlyCounter += laplaceOnly;
 
         // update inclusion probabilities for covariate (groups)
         mod.pushInclusionProbs(fpInfo, ucInfo, bookkeep); //TODO
@@ -509,6 +601,7 @@ glmModelsInList(const DataValues& data,
                 Book& bookkeep,
                 const GlmModelConfig& config,
                 const GaussHermite& gaussHermite,
+                ModelStore& store,
                 const List& rcpp_modelConfigs)
 {
     // ------------
@@ -546,7 +639,7 @@ glmModelsInList(const DataValues& data,
 
         // compute this one
         computeGlm(modelConfig, orderedModels,
-                   data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+                   data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
 
     }
 
@@ -616,7 +709,8 @@ glmPermPars(PosInt pos, // current position in parameter vector, starting from 0
             const FixInfo& fixInfo,
             Book& bookkeep,
             const GlmModelConfig& config,
-            const GaussHermite& gaussHermite)
+            const GaussHermite& gaussHermite,
+            ModelStore& store)
 
 {
     // if some fps are still left
@@ -627,7 +721,7 @@ glmPermPars(PosInt pos, // current position in parameter vector, starting from 0
 
         // degree 0:
         glmPermPars(pos + 1, mod, space,
-                    data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+                    data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
 
         // different degrees for fp at pos:
         // degrees 1, ..., fpmax
@@ -653,7 +747,7 @@ glmPermPars(PosInt pos, // current position in parameter vector, starting from 0
 
                 // and go on
                 glmPermPars(pos + 1, mod, space,
-                            data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+                            data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
             }
             while (more1);
         }
@@ -662,7 +756,7 @@ glmPermPars(PosInt pos, // current position in parameter vector, starting from 0
     {
         // no uc group
         computeGlm(mod, space,
-                   data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite); //TODO IS THIS THE NULL  MODEL? IF SO ADD NULL+FIXED NEXT
+                   data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store); //TODO IS THIS THE NULL  MODEL? IF SO ADD NULL+FIXED NEXT
 
         // different positive number (deg) of uc groups
         for (PosInt deg = 1; deg <= ucInfo.nUcGroups; deg++)
@@ -684,7 +778,7 @@ glmPermPars(PosInt pos, // current position in parameter vector, starting from 0
 
                 // and compute this model
                 computeGlm(mod, space,
-                           data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+                           data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
             }
             while (more2);
         }
@@ -693,6 +787,472 @@ glmPermPars(PosInt pos, // current position in parameter vector, starting from 0
 
 // ***************************************************************************************************//
 
+// minimal change recursion: a reflected mixed-radix Gray code over the FPs (with all power
+// multisets as values) and the UC groups (absent or present). Each coordinate sweeps its values
+// alternately forwards and backwards, so consecutive models differ in one FP or UC group only.
+// The IWLS of each model then starts from the linear predictor of the previous model.
+void
+glmGrayPermPars(PosInt pos, // current position in the vector of FPs and UC groups, starting from 0
+                const std::vector<PowersVector>& fpValues, // the values of each FP
+                std::vector<bool>& forward, // the current sweep directions
+                ModelPar& mod, // the current model, changed in place
+                AVector& linPredWarmStart, // the linear predictor of the previous model
+                set<Model>& space,
+                const DataValues& data,
+                const FpInfo& fpInfo,
+                const UcInfo& ucInfo,
+                const FixInfo& fixInfo,
+                Book& bookkeep,
+                const GlmModelConfig& config,
+                const GaussHermite& gaussHermite,
+                ModelStore& store)
+{
+    // all coordinates are set
+    if (pos == fpInfo.nFps + ucInfo.nUcGroups)
+    {
+        computeGlm(mod, space,
+                   data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store, &linPredWarmStart);
+        return;
+    }
+
+    if (pos < fpInfo.nFps) // an FP
+    {
+        const PowersVector& values = fpValues.at(pos);
+        for (PowersVector::size_type k = 0; k != values.size(); k++)
+        {
+            const Powers& now = values[forward[pos] ? k : values.size() - 1 - k];
+            mod.fpSize -= mod.fpPars.at(pos).size();
+            mod.fpSize += now.size();
+            mod.fpPars.at(pos) = now;
+
+            glmGrayPermPars(pos + 1, fpValues, forward, mod, linPredWarmStart, space,
+                            data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
+        }
+    }
+    else // a UC group
+    {
+        const Int group = pos - fpInfo.nFps + 1;
+        for (int k = 0; k != 2; k++)
+        {
+            const bool present = forward[pos] ? (k == 1) : (k == 0);
+            if (present)
+                mod.ucPars.insert(group);
+            else
+                mod.ucPars.erase(group);
+
+            glmGrayPermPars(pos + 1, fpValues, forward, mod, linPredWarmStart, space,
+                            data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
+        }
+    }
+
+    // the next sweep goes the other way round
+    forward[pos] = ! forward[pos];
+}
+
+// propose a new model in the MCMC model search: "now" starts as a copy of the current model "old"
+// of the chain and is changed by a birth, death, move or switch step.
+// Returns the log proposal ratio.
+static double
+proposeModel(const ModelMcmc& old,
+             ModelMcmc& now,
+             const FpInfo& fpInfo,
+             const UcInfo& ucInfo,
+             PosInt maxDim,
+             const ProposalWeights& proposal,
+             RngStream& rng)
+{
+    double logPropRatio; // log proposal ratio
+
+    // randomly select move type
+    double u1 = rng.unif();
+
+    if (u1 < old.birthprob)
+    {                                                                                        // BIRTH
+            PosInt newCovInd = proposal.drawBirthCov(old.freeCovs, rng);
+
+            if (newCovInd <= fpInfo.nFps)
+            {                                                                                // some fp index
+                    Int powerIndex = proposal.drawPower(newCovInd, rng);
+                    now.modPar.fpPars.at(newCovInd-1).insert(powerIndex);
+                    now.modPar.fpSize++; // correct invariants
+                    now.dim++;
+                    now.updateFreeUcs(ucInfo, maxDim, old.dim, 0);
+                    PosInt newPowersEqualPowerIndex = count(now.modPar.fpPars.at(newCovInd-1).begin(), now.modPar.fpPars.at(newCovInd-1).end(), powerIndex);
+                    PosInt m = old.modPar.fpPars.at(newCovInd-1).size();
+
+                    logPropRatio = log(double(newPowersEqualPowerIndex)) + log(proposal.powerWeightSum(newCovInd)) -
+                            log(proposal.powerWeight(newCovInd, powerIndex)) - log1p(m);
+            }
+            else
+            {                                                                                // uc index
+                    Int index = discreteUniform(old.freeUcs, rng);
+                    now.modPar.ucPars.insert(index);
+                    now.dim += ucInfo.ucSizes.at(index - 1);
+                    now.updateFreeUcs(ucInfo, maxDim, old.dim, index);
+
+                    logPropRatio = log(double(old.freeUcs.size())) - log(double(now.modPar.ucPars.size()));
+            }
+
+            now.presentCovs.insert(newCovInd);
+            now.updateFreeCovs(fpInfo, maxDim, old.dim, newCovInd);
+
+            if (now.dim == maxDim)
+            {
+                    now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3 : 0.5;
+            } else
+            {
+                    now.birthprob = now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
+            }
+
+            logPropRatio += log(now.deathprob) - log(old.birthprob) +
+                    log(proposal.birthWeightSum(old.freeCovs)) - log(proposal.birthWeight(newCovInd)) -
+                    log(proposal.deathWeightSum(now.presentCovs)) + log(proposal.deathWeight(newCovInd));
+
+    }
+    else if
+    (u1 < old.birthprob + old.deathprob)
+    {                                                                                      // DEATH
+            PosInt oldCovInd = proposal.drawDeathCov(old.presentCovs, rng);
+
+            if (oldCovInd <= fpInfo.nFps)
+            {                                                                            // some fp index
+                    Powers::iterator powerIterator = discreteUniform(now.modPar.fpPars.at(oldCovInd-1), rng);
+                    const Int oldPowerIndex = *powerIterator;
+                    PosInt oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(oldCovInd-1).begin(), old.modPar.fpPars.at(oldCovInd-1).end(), *powerIterator);
+                    now.modPar.fpPars.at(oldCovInd-1).erase(powerIterator);
+                    now.modPar.fpSize--; // correct invariants
+                    now.dim--;
+                    now.updateFreeUcs(ucInfo, maxDim, old.dim, 0);
+
+                    logPropRatio =  - log(double(oldPowersEqualPowerIndex)) - log(proposal.powerWeightSum(oldCovInd)) +
+                            log(proposal.powerWeight(oldCovInd, oldPowerIndex)) + log(double(old.modPar.fpPars.at(oldCovInd-1).size()));
+
+            } else {                                                                                                        // uc index
+                    IntSet::iterator IndIterator = discreteUniform(now.modPar.ucPars, rng);
+                    const Int oldIndex = *IndIterator;
+//                            now.modPar.ucSize--;
+                    now.dim -= ucInfo.ucSizes.at(oldIndex - 1);
+                    now.modPar.ucPars.erase(IndIterator);
+                    now.updateFreeUcs(ucInfo, maxDim, old.dim, oldIndex);
+                    logPropRatio = log(double(old.modPar.ucPars.size())) - log(double(now.freeUcs.size()));
+            }
+            now.updatePresentCov(oldCovInd);
+            now.updateFreeCovs(fpInfo, maxDim, old.dim, oldCovInd);
+            if (now.dim == 1)
+            {
+                    now.birthprob = 1; now.deathprob = now.moveprob = 0;
+            } else
+            {
+                    now.birthprob = now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3.0;
+            }
+            logPropRatio += log(now.birthprob) - log(old.deathprob) +
+                    log(proposal.deathWeightSum(old.presentCovs)) - log(proposal.deathWeight(oldCovInd)) -
+                    log(proposal.birthWeightSum(now.freeCovs)) + log(proposal.birthWeight(oldCovInd));
+
+    }
+    else if (u1 < old.birthprob + old.deathprob + old.moveprob)
+    {                                                                                   // MOVE
+            PosInt CovInd = discreteUniform(old.presentCovs, rng);
+
+            if (CovInd <= fpInfo.nFps)
+            {                                                                     // some fp index
+                    Powers::iterator powerIterator = discreteUniform(now.modPar.fpPars.at(CovInd-1), rng);
+                    const Int oldPowerIndex = *powerIterator;
+                    PosInt oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(CovInd-1).begin(), old.modPar.fpPars.at(CovInd-1).end(), oldPowerIndex);
+                    now.modPar.fpPars.at(CovInd-1).erase(powerIterator);
+                    Int powerIndex = proposal.drawPower(CovInd, rng);
+                    now.modPar.fpPars.at(CovInd-1).insert(powerIndex);
+                    PosInt newPowersEqualPowerIndex = count(now.modPar.fpPars.at(CovInd-1).begin(), now.modPar.fpPars.at(CovInd-1).end(), powerIndex);
+                    // free, present Covs and move type probs are unchanged
+                    logPropRatio = log(double(newPowersEqualPowerIndex)) - log(double(oldPowersEqualPowerIndex)) +
+                            log(proposal.powerWeight(CovInd, oldPowerIndex)) - log(proposal.powerWeight(CovInd, powerIndex));
+            }
+            else
+            {                                                                                                        // uc index
+                    IntSet::iterator IndIterator = discreteUniform(now.modPar.ucPars, rng);
+                    const Int oldIndex = *IndIterator;
+                    now.dim -= ucInfo.ucSizes.at(oldIndex - 1);
+                    now.modPar.ucPars.erase(IndIterator);
+                    now.updateFreeUcs(ucInfo, maxDim, old.dim, oldIndex);
+                    Int index = discreteUniform(now.freeUcs, rng);
+                    const PosInt reducedDim = now.dim;
+                    now.modPar.ucPars.insert(index);
+                    now.dim += ucInfo.ucSizes.at(index - 1);
+                    now.updateFreeUcs(ucInfo, maxDim, reducedDim, index);
+                    // here something may change, therefore:
+                    now.updateFreeCovs(fpInfo, maxDim, old.dim, 0);
+                    if (now.dim == maxDim)
+                    {
+                            now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3.0 : 0.5;
+                    }
+                    else
+                    {
+                            now.birthprob = now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3.0;
+                    }
+                    logPropRatio = 0.0;
+            }
+    } else {                                                                                                        // SWITCH (of FP vectors)
+            // select only from the FP present covs,
+            // so we have the first power vector:
+            PosInt firstFpInd = discreteUniform(old.presentCovs, rng, fpInfo.nFps + 1);
+            Powers first = now.modPar.fpPars.at(firstFpInd - 1);
+
+            // the second power vector from all other FPs
+            PosInt secondFpInd = discreteUniform<PosInt>(1, fpInfo.nFps, rng);
+            if (secondFpInd >= firstFpInd)
+            {
+                    secondFpInd++;
+            }
+            Powers second = now.modPar.fpPars.at(secondFpInd - 1);
+
+            // save the first
+            Powers saveFirst = first;
+
+            // copy second to first
+            now.modPar.fpPars.at(firstFpInd - 1) = second;
+
+            // and save to second
+            now.modPar.fpPars.at(secondFpInd - 1) = saveFirst;
+
+            // so now we have switched the power vectors.
+
+            // move type probs are not changed, because the number of present FPs is unchanged,
+            // as well as the dimension of the model.
+
+            // but carefully update the information which covariates are free and which are present
+            now.updatePresentCov(firstFpInd);
+            now.updatePresentCov(secondFpInd);
+            now.updateFreeCovs(fpInfo, maxDim, old.dim, firstFpInd, secondFpInd);
+
+            // and the proposal ratio is 1, thus the log proposal ratio is 0:
+            logPropRatio = 0;
+    }
+
+    return logPropRatio;
+}
+
+// ***************************************************************************************************//
+
+// get log marg lik and log prior of the proposed model "now", from the model cache if
+// it has been visited before, otherwise from the model store if it has been computed in an
+// earlier run, otherwise compute them. New models are inserted into the cache (and the store).
+// A non-identifiable model gets a NaN log marg lik.
+// Returns whether the log marg lik was computed now.
+static bool
+evaluateModel(ModelMcmc& now,
+              ModelCache& modelCache,
+              const DataValues& data,
+              const FpInfo& fpInfo,
+              const UcInfo& ucInfo,
+              const FixInfo& fixInfo,
+              Book& bookkeep,
+              const GlmModelConfig& config,
+              const GaussHermite& gaussHermite,
+              ModelStore& store)
+{
+    // search for log marg lik of proposed model
+    GlmModelInfo nowInfo = modelCache.getModelInfo(now.modPar);
+    bool computed = false;
+
+    if (R_IsNA(nowInfo.logMargLik))
+    { // "now" is a new model
+
+        double zMode = 0.0;
+        double zVar = 0.0;
+        double laplaceApprox = 0.0;
+        double residualDeviance = R_NaReal;
+        bool laplaceOnly = false;
+        Cache cache;
+
+        // the log prior is needed first to decide whether the model is negligible
+        now.logPrior = getVarLogPrior(now.modPar,
+                                      fpInfo,
+                                      ucInfo,
+                                      fixInfo,
+                                      bookkeep);
+
+        if(const GlmModelInfo* stored = store.find(now.modPar))
+        { // computed in an earlier run
+            now.logMargLik = stored->logMargLik;
+            cache = stored->negLogUnnormZDensities;
+            zMode = stored->zMode;
+            zVar = stored->zVar;
+            laplaceApprox = stored->laplaceApprox;
+            residualDeviance = stored->residualDeviance;
+        }
+        else
+        { // so we must compute the log marg lik now.
+            computed = true;
+            now.logMargLik = getGlmVarLogMargLik(now.modPar,
+                                                 data,
+                                                 fpInfo,
+                                                 ucInfo,
+                                                 fixInfo,
+                                                 bookkeep,
+                                                 config,
+                                                 gaussHermite,
+                                                 cache,
+                                                 zMode,
+                                                 zVar,
+                                                 laplaceApprox,
+                                                 residualDeviance,
+                                                 0,
+                                                 bookkeep.laplaceOnlyBound(now.logPrior),
+                                                 &laplaceOnly);
+        }
+
+        // check if the new model is OK
+        if (R_IsNaN(now.logMargLik))
+        {
+            // we do not save this model in the model cache
+            bookkeep.nanCounter++;
+        }
+        else
+        { // OK: then insert into model cache
+
+            bookkeep.maxLogPosterior = std::max(bookkeep.maxLogPosterior, now.logMargLik + now.logPrior);
+            bookkeep.laplaceOnlyCounter += laplaceOnly;
+
+            // insert the model parameter/info into the model cache
+            // (and into the store, where it is not added again if it was found there,
+            // and where Laplace-only models are not added)
+            if(! laplaceOnly)
+            {
+                store.add(now.modPar, GlmModelInfo(now.logMargLik, R_NaReal, cache, zMode, zVar, laplaceApprox,
+                                                   residualDeviance));
+            }
+
+            // keep only a compact z density cache if requested
+            if(bookkeep.zCachePoints > 0)
+            {
+                cache.compact(bookkeep.zCachePoints);
+            }
+
+            // problem: this could erase the old model from the model cache,
+            // and invalidate the iterator old.mapPos!
+            // ==> so we cannot work with the iterators here.
+            modelCache.insert(now.modPar,
+                          GlmModelInfo(now.logMargLik,
+                                       now.logPrior,
+                                       cache,
+                                       zMode,
+                                       zVar,
+                                       laplaceApprox,
+                                       residualDeviance,
+                                       laplaceOnly));
+        }
+    }
+    else // "now" is an old model
+    {
+        // extract log marg lik and prior from the modelInfo object
+        now.logMargLik = nowInfo.logMargLik;
+        now.logPrior = nowInfo.logPrior;
+    }
+
+    return computed;
+}
+
+// ***************************************************************************************************//
+
+// one replica of the population in the parallel tempering sampler
+struct Replica
+{
+    Replica(const ModelMcmc& old,
+            const ModelMcmc& now,
+            double beta,
+            const RngStream& rng) :
+                old(old),
+                now(now),
+                beta(beta),
+                rng(rng)
+    {
+    }
+
+    // the current and the proposed model
+    ModelMcmc old;
+    ModelMcmc now;
+
+    // the inverse temperature: the replica samples from the posterior to this power
+    double beta;
+
+    // the own random number stream
+    RngStream rng;
+};
+
+// ***************************************************************************************************//
+
+// write the state of the model sampler after t iterations to the checkpoint file:
+// the counters, the replicas with their random number streams, the proposal weights,
+// the diagnostics and all cached models.
+static void
+saveSampler(const CheckpointOptions& options,
+            const MyDoubleVector& fingerprint,
+            PosLargeInt t,
+            const Book& bookkeep,
+            const std::vector<Replica>& replicas,
+            const RngStream& swapRng,
+            const ProposalWeights& proposal,
+            const ChainDiagnostics& diagnostics,
+            const ModelCache& modelCache)
+{
+    CheckpointWriter checkpoint(options.fileName, fingerprint);
+
+    checkpoint.write(t);
+    checkpoint.write(bookkeep.nanCounter);
+    checkpoint.write(bookkeep.laplaceOnlyCounter);
+    checkpoint.write(bookkeep.maxLogPosterior);
+
+    for(std::vector<Replica>::const_iterator r = replicas.begin(); r != replicas.end(); ++r)
+    {
+        r->old.save(checkpoint);
+        r->rng.save(checkpoint);
+    }
+    swapRng.save(checkpoint);
+
+    proposal.save(checkpoint);
+    diagnostics.save(checkpoint);
+    modelCache.save(checkpoint);
+
+    checkpoint.commit();
+}
+
+// restore the state of the model sampler from the checkpoint file,
+// and return the number of iterations done so far
+static PosLargeInt
+restoreSampler(const CheckpointOptions& options,
+               const MyDoubleVector& fingerprint,
+               Book& bookkeep,
+               std::vector<Replica>& replicas,
+               RngStream& swapRng,
+               ProposalWeights& proposal,
+               ChainDiagnostics& diagnostics,
+               ModelCache& modelCache)
+{
+    CheckpointReader checkpoint(options.fileName, fingerprint);
+
+    PosLargeInt t;
+    checkpoint.read(t);
+    checkpoint.read(bookkeep.nanCounter);
+    checkpoint.read(bookkeep.laplaceOnlyCounter);
+    checkpoint.read(bookkeep.maxLogPosterior);
+
+    for(std::vector<Replica>::iterator r = replicas.begin(); r != replicas.end(); ++r)
+    {
+        r->old.restore(checkpoint);
+        r->now = r->old;
+        r->rng.restore(checkpoint);
+    }
+    swapRng.restore(checkpoint);
+
+    proposal.restore(checkpoint);
+    diagnostics.restore(checkpoint);
+    modelCache.restore(checkpoint);
+
+    return t;
+}
+
+// ***************************************************************************************************//
+
 List
 glmSampling(const DataValues& data,
             const FpInfo& fpInfo,
@@ -700,7 +1260,14 @@ glmSampling(const DataValues& data,
             const FixInfo& fixInfo,
             Book& bookkeep,
             const GlmModelConfig& config,
-            const GaussHermite& gaussHermite)
+            const GaussHermite& gaussHermite,
+            PosLargeInt adaptationLength,
+            const MyDoubleVector& temperatures,
+            PosLargeInt swapInterval,
+            const CheckpointOptions& checkpoint,
+            AnytimeStop& anytimeStop,
+            ModelStore& store,
+            RngStream& rng)
 {
     // models which can be found during chain run can be cached in here:
     ModelCache modelCache(bookkeep.nCache);
@@ -708,9 +1275,6 @@ glmSampling(const DataValues& data,
     // upper limit for num of columns: min(n, maximum fixed + fp + uc columns).
     PosInt maxDim = std::min(static_cast<PosInt>(data.nObs), 1 + fpInfo.maxFpDim + ucInfo.maxUcDim);
 
-    // the FP range
-    const PosIntSet fpRange = constructSequence(fpInfo.nFps);
-
     // start model is the null model!
     ModelMcmc old(fpInfo,
                   ucInfo,
@@ -781,253 +1345,180 @@ glmSampling(const DataValues& data,
       now = now2;
     }
     
-    // Start MCMC sampler***********************************************************//
-
-    GetRNGstate(); // use R's random number generator
+    // the proposal weights, which are adapted during the first adaptationLength iterations,
+    // and the efficiency diagnostics of the chain
+    ProposalWeights proposal(fpInfo.fpcards, adaptationLength);
+    ChainDiagnostics diagnostics(bookkeep.chainlength, adaptationLength, temperatures.size());
+
+    // the replicas for parallel tempering: replica r samples from the posterior to the power
+    // 1 / temperatures[r]. Replica 0 is the cold chain at temperature 1, and only its visits
+    // are counted in the model cache and used for learning the proposal weights.
+    // All replicas share the model cache, so each model is evaluated only once.
+    // With only the cold chain, this is the usual sampler.
+    const PosInt nReplicas = temperatures.size();
+    std::vector<Replica> replicas;
+    replicas.reserve(nReplicas);
+    for(PosInt r = 0; r != nReplicas; ++r)
+    {
+        replicas.push_back(Replica(old, now, 1.0 / temperatures[r], (r == 0) ? rng : rng.split(r)));
+    }
 
-    for(PosLargeInt t = 0; t != bookkeep.chainlength; /* ++t explicitly at the end */)
+    // the stream for the swap moves between the replicas
+    RngStream swapRng = rng.split(nReplicas);
+
+    // the fingerprint of this model search, which a checkpoint must match for resuming
+    MyDoubleVector fingerprint;
+    fingerprint.push_back(data.nObs);
+    fingerprint.push_back(arma::accu(data.design));
+    fingerprint.push_back(arma::accu(data.response));
+    fingerprint.push_back(fpInfo.nFps);
+    fingerprint.insert(fingerprint.end(), fpInfo.fpcards.begin(), fpInfo.fpcards.end());
+    fingerprint.insert(fingerprint.end(), fpInfo.fpmaxs.begin(), fpInfo.fpmaxs.end());
+    fingerprint.insert(fingerprint.end(), ucInfo.ucSizes.begin(), ucInfo.ucSizes.end());
+    fingerprint.push_back(fixInfo.nFixGroups);
+    fingerprint.push_back(config.nullModelLogMargLik);
+    fingerprint.push_back(adaptationLength);
+    fingerprint.insert(fingerprint.end(), temperatures.begin(), temperatures.end());
+    fingerprint.push_back(swapInterval);
+    fingerprint.push_back(rng.isLegacy());
+
+    // number of iterations done so far
+    PosLargeInt t = 0;
+
+    // the number of models computed so far, and the included FPs and UC groups of the
+    // cold chain model, for the anytime mode
+    PosLargeInt nEvaluations = 0;
+    std::vector<bool> included(fpInfo.nFps + ucInfo.nUcGroups);
+
+    // continue a chain from the checkpoint?
+    if(checkpoint.resume)
     {
-            double logPropRatio; // log proposal ratio
+        t = restoreSampler(checkpoint, fingerprint, bookkeep, replicas, swapRng, proposal, diagnostics, modelCache);
 
-            // randomly select move type
-            double u1 = unif_rand();
+        if(t > bookkeep.chainlength)
+        {
+            Rcpp::stop("the checkpointed chain has already more iterations than chainlength");
+        }
 
-            if (u1 < old.birthprob)
-            {                                                                                        // BIRTH
-                    PosInt newCovInd = *discreteUniform<PosIntSet>(old.freeCovs);
+        if(bookkeep.verbose)
+        {
+            Rprintf("\nResuming the chain after %lu iterations\n", t);
+        }
+    }
 
-                    if (newCovInd <= fpInfo.nFps)
-                    {                                                                                // some fp index
-                            Int powerIndex = discreteUniform<Int>(0, fpInfo.fpcards[newCovInd-1]);
-                            now.modPar.fpPars.at(newCovInd-1).insert(powerIndex);
-                            now.modPar.fpSize++; // correct invariants
-                            now.dim++;
-                            PosInt newPowersEqualPowerIndex = count(now.modPar.fpPars.at(newCovInd-1).begin(), now.modPar.fpPars.at(newCovInd-1).end(), powerIndex);
-                            PosInt m = old.modPar.fpPars.at(newCovInd-1).size();
+    // Start MCMC sampler***********************************************************//
 
-                            logPropRatio = log(double(newPowersEqualPowerIndex)) + log(double(fpInfo.fpcards[newCovInd-1])) - log1p(m);
-                    }
-                    else
-                    {                                                                                // uc index
-                            Int index = *discreteUniform(old.freeUcs);
-                            now.modPar.ucPars.insert(index);
-                            now.dim += ucInfo.ucSizes.at(index - 1);
-                            now.freeUcs = now.modPar.getFreeUcs(ucInfo.ucSizes, now.dim, maxDim);
+    GetRNGstate(); // use R's random number generator (only needed for the legacy stream)
 
-                            logPropRatio = log(double(old.freeUcs.size())) - log(double(now.modPar.ucPars.size()));
-                    }
+    for(; t != bookkeep.chainlength; /* ++t explicitly at the end */)
+    {
+            bool coldAccepted = false;
 
-                    now.presentCovs.insert(newCovInd);
-                    now.freeCovs = now.modPar.getFreeCovs(fpInfo, now.freeUcs, now.dim, maxDim);
+            // a Metropolis-Hastings step in each replica
+            for(PosInt r = 0; r != nReplicas; ++r)
+            {
+                Replica& rep = replicas[r];
 
-                    if (now.dim == maxDim)
-                    {
-                            now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3 : 0.5;
-                    } else
-                    {
-                            now.birthprob = now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3;
-                    }
+                const double logPropRatio = proposeModel(rep.old, rep.now, fpInfo, ucInfo, maxDim,
+                                                         proposal, rep.rng);
 
-                    logPropRatio += log(now.deathprob) - log(old.birthprob) + log(double(old.freeCovs.size())) - log(double(now.presentCovs.size()));
+                if(evaluateModel(rep.now, modelCache, data, fpInfo, ucInfo, fixInfo, bookkeep,
+                                 config, gaussHermite, store))
+                {
+                    nEvaluations++;
+                }
 
-            }
-            else if
-            (u1 < old.birthprob + old.deathprob)
-            {                                                                                      // DEATH
-                    PosInt oldCovInd = *discreteUniform(old.presentCovs);
-
-                    if (oldCovInd <= fpInfo.nFps)
-                    {                                                                            // some fp index
-                            Powers::iterator powerIterator = discreteUniform(now.modPar.fpPars.at(oldCovInd-1));
-                            PosInt oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(oldCovInd-1).begin(), old.modPar.fpPars.at(oldCovInd-1).end(), *powerIterator);
-                            now.modPar.fpPars.at(oldCovInd-1).erase(powerIterator);
-                            now.modPar.fpSize--; // correct invariants
-                            now.dim--;
-
-                            logPropRatio =  - log(double(oldPowersEqualPowerIndex)) - log(double(fpInfo.fpcards[oldCovInd-1])) + log(double(old.modPar.fpPars.at(oldCovInd-1).size()));
-
-                    } else {                                                                                                        // uc index
-                            IntSet::iterator IndIterator = discreteUniform(now.modPar.ucPars);
-//                            now.modPar.ucSize--;
-                            now.dim -= ucInfo.ucSizes.at(*IndIterator - 1);
-                            now.modPar.ucPars.erase(IndIterator);
-                            now.freeUcs = now.modPar.getFreeUcs(ucInfo.ucSizes, now.dim, maxDim);
-                            logPropRatio = log(double(old.modPar.ucPars.size())) - log(double(now.freeUcs.size()));
-                    }
-                    now.presentCovs = now.modPar.getPresentCovs();
-                    now.freeCovs = now.modPar.getFreeCovs(fpInfo, now.freeUcs, now.dim, maxDim);
-                    if (now.dim == 1)
-                    {
-                            now.birthprob = 1; now.deathprob = now.moveprob = 0;
-                    } else
-                    {
-                            now.birthprob = now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3.0;
-                    }
-                    logPropRatio += log(now.birthprob) - log(old.deathprob) + log(double(old.presentCovs.size())) - log(double(now.freeCovs.size()));
+                // decide acceptance at the temperature of the replica:
+                // for acceptance, the new model must be valid and the acceptance must be sampled
+                const bool accepted = (R_IsNaN(rep.now.logMargLik) == FALSE) &&
+                    (rep.rng.unif() <= exp(rep.beta * (rep.now.logMargLik - rep.old.logMargLik + rep.now.logPrior - rep.old.logPrior) +
+                                           logPropRatio));
+                if (accepted)
+                { // acceptance
+                    rep.old = rep.now;
+                }
+                else
+                { // rejection
+                    rep.now = rep.old;
+                }
 
+                if (r == 0)
+                {
+                    coldAccepted = accepted;
+                }
             }
-            else if (u1 < old.birthprob + old.deathprob + old.moveprob)
-            {                                                                                   // MOVE
-                    PosInt CovInd = *discreteUniform<PosIntSet>(old.presentCovs);
-
-                    if (CovInd <= fpInfo.nFps)
-                    {                                                                     // some fp index
-                            Powers::iterator powerIterator = discreteUniform(now.modPar.fpPars.at(CovInd-1));
-                            PosInt oldPowersEqualPowerIndex = count(old.modPar.fpPars.at(CovInd-1).begin(), old.modPar.fpPars.at(CovInd-1).end(), *powerIterator);
-                            now.modPar.fpPars.at(CovInd-1).erase(powerIterator);
-                            Int powerIndex = discreteUniform<Int>(0, fpInfo.fpcards[CovInd-1]);
-                            now.modPar.fpPars.at(CovInd-1).insert(powerIndex);
-                            PosInt newPowersEqualPowerIndex = count(now.modPar.fpPars.at(CovInd-1).begin(), now.modPar.fpPars.at(CovInd-1).end(), powerIndex);
-                            // free, present Covs and move type probs are unchanged
-                            logPropRatio = log(double(newPowersEqualPowerIndex)) - log(double(oldPowersEqualPowerIndex));
-                    }
-                    else
-                    {                                                                                                        // uc index
-                            IntSet::iterator IndIterator = discreteUniform(now.modPar.ucPars);
-                            now.dim -= ucInfo.ucSizes.at(*IndIterator - 1);
-                            now.modPar.ucPars.erase(IndIterator);
-                            now.freeUcs = now.modPar.getFreeUcs(ucInfo.ucSizes, now.dim, maxDim);
-                            Int index = *discreteUniform<IntSet>(now.freeUcs);
-                            now.modPar.ucPars.insert(index);
-                            now.dim += ucInfo.ucSizes.at(index - 1);
-                            now.freeUcs = now.modPar.getFreeUcs(ucInfo.ucSizes, now.dim, maxDim);
-                            // here something may change, therefore:
-                            now.freeCovs = now.modPar.getFreeCovs(fpInfo, now.freeUcs, now.dim, maxDim);
-                            if (now.dim == maxDim)
-                            {
-                                    now.birthprob = 0; now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 1.0 / 3.0 : 0.5;
-                            }
-                            else
-                            {
-                                    now.birthprob = now.deathprob = now.moveprob = (now.modPar.fpSize > 0) ? 0.25 : 1.0 / 3.0;
-                            }
-                            logPropRatio = 0.0;
-                    }
-            } else {                                                                                                        // SWITCH (of FP vectors)
-                    // select only the FP present covs
-                    PosIntSet presentFps = removeElement(old.presentCovs, fpInfo.nFps + 1);
-
-                    // so we have the first power vector:
-                    PosInt firstFpInd = *discreteUniform<PosIntSet>(presentFps);
-                    Powers first = now.modPar.fpPars.at(firstFpInd - 1);
-
-                    // the second power vector from all other FPs
-                    PosIntSet otherFps = removeElement(fpRange, firstFpInd);
-                    PosInt secondFpInd = *discreteUniform<PosIntSet>(otherFps);
-                    Powers second = now.modPar.fpPars.at(secondFpInd - 1);
 
-                    // save the first
-                    Powers saveFirst = first;
-
-                    // copy second to first
-                    now.modPar.fpPars.at(firstFpInd - 1) = second;
-
-                    // and save to second
-                    now.modPar.fpPars.at(secondFpInd - 1) = saveFirst;
-
-                    // so now we have switched the power vectors.
+            // every swapInterval iterations, propose to exchange the models
+            // of a random pair of neighbouring replicas
+            if ((nReplicas > 1) && ((t + 1) % swapInterval == 0))
+            {
+                const PosInt i = discreteUniform<PosInt>(0, nReplicas - 1, swapRng);
+                Replica& colder = replicas[i];
+                Replica& hotter = replicas[i + 1];
 
-                    // move type probs are not changed, because the number of present FPs is unchanged,
-                    // as well as the dimension of the model.
+                const double logSwapRatio = (colder.beta - hotter.beta) *
+                        (hotter.old.logMargLik + hotter.old.logPrior - colder.old.logMargLik - colder.old.logPrior);
 
-                    // but carefully update the information which covariates are free and which are present
-                    now.freeCovs = now.modPar.getFreeCovs(fpInfo, now.freeUcs, now.dim, maxDim);
-                    now.presentCovs = now.modPar.getPresentCovs();
+                const bool swapped = (swapRng.unif() <= exp(logSwapRatio));
+                if (swapped)
+                {
+                    std::swap(colder.old, hotter.old);
+                    colder.now = colder.old;
+                    hotter.now = hotter.old;
+                }
 
-                    // and the proposal ratio is 1, thus the log proposal ratio is 0:
-                    logPropRatio = 0;
+                diagnostics.recordSwap(i, swapped);
             }
 
-            // search for log marg lik of proposed model
-            GlmModelInfo nowInfo = modelCache.getModelInfo(now.modPar);
-
-            if (R_IsNA(nowInfo.logMargLik))
-            { // "now" is a new model
+            // so now definitely old == now for the cold chain, and we can
+            // increment the associated sampling frequency.
+            const ModelMcmc& cold = replicas[0].old;
+            modelCache.incrementFrequency(cold.modPar);
 
-                double zMode = 0.0;
-                double zVar = 0.0;
-                double laplaceApprox = 0.0;
-                double residualDeviance = R_NaReal;
-                Cache cache;
+            // learn the proposal weights and record the efficiency diagnostics
+            proposal.record(t, cold.modPar.fpPars, ! cold.modPar.ucPars.empty());
+            diagnostics.record(t, coldAccepted, cold.logMargLik + cold.logPrior, cold.dim);
 
-                // so we must compute the log marg lik now.
-                now.logMargLik = getGlmVarLogMargLik(now.modPar,
-                                                 data,
-                                                 fpInfo,
-                                                 ucInfo,
-                                                 fixInfo,
-                                                 bookkeep,
-                                                 config,
-                                                 gaussHermite,
-                                                 cache,
-                                                 zMode,
-                                                 zVar,
-                                                 laplaceApprox,
-                                                 residualDeviance);
+            // echo progress?
+            if((++t % std::max(bookkeep.chainlength / 100, static_cast<PosLargeInt>(1)) == 0) &&
+                bookkeep.verbose)
+            {
+                    Rprintf("-"); // display computation progress at each percent
+            }
 
-                // check if the new model is OK
-                if (R_IsNaN(now.logMargLik))
+            // stop early in the anytime mode?
+            if(anytimeStop.checksConvergence())
+            {
+                for(PosInt i = 0; i != fpInfo.nFps; i++)
                 {
-                    // we do not save this model in the model cache
-                    bookkeep.nanCounter++;
+                    included[i] = ! cold.modPar.fpPars[i].empty();
                 }
-                else
-                { // OK: then compute the rest, and insert into model cache
-
-                    now.logPrior = getVarLogPrior(now.modPar,
-                                              fpInfo,
-                                              ucInfo,
-                                              fixInfo,
-                                              bookkeep);
-
-                    // insert the model parameter/info into the model cache
-
-                    // problem: this could erase the old model from the model cache,
-                    // and invalidate the iterator old.mapPos!
-                    // ==> so we cannot work with the iterators here.
-                    modelCache.insert(now.modPar,
-                                  GlmModelInfo(now.logMargLik,
-                                               now.logPrior,
-                                               cache,
-                                               zMode,
-                                               zVar,
-                                               laplaceApprox,
-                                               residualDeviance));
+                for(PosInt g = 1; g <= ucInfo.nUcGroups; g++)
+                {
+                    included[fpInfo.nFps + g - 1] = cold.modPar.ucPars.count(g) > 0;
                 }
             }
-            else // "now" is an old model
-            {
-                // extract log marg lik and prior from the modelInfo object
-                now.logMargLik = nowInfo.logMargLik;
-                now.logPrior = nowInfo.logPrior;
-            }
+            const bool stopNow = anytimeStop.stop(included, nEvaluations);
 
-            // decide acceptance:
-            // for acceptance, the new model must be valid and the acceptance must be sampled
-            if ((R_IsNaN(now.logMargLik) == FALSE) &&
-                (unif_rand() <= exp(now.logMargLik - old.logMargLik + now.logPrior - old.logPrior + logPropRatio)))
-            { // acceptance
-                old = now;
-            }
-            else
-            { // rejection
-                now = old;
+            // write a checkpoint regularly, at the end of the chain and when it stops early
+            if(checkpoint.active() &&
+               ((t % checkpoint.interval == 0) || (t == bookkeep.chainlength) || stopNow))
+            {
+                saveSampler(checkpoint, fingerprint, t, bookkeep, replicas, swapRng, proposal, diagnostics, modelCache);
             }
 
-            // so now definitely old == now, and we can
-            // increment the associated sampling frequency.
-            modelCache.incrementFrequency(now.modPar);
-
-            // echo progress?
-            if((++t % std::max(bookkeep.chainlength / 100, static_cast<PosLargeInt>(1)) == 0) &&
-                bookkeep.verbose)
+            if(stopNow)
             {
-                    Rprintf("-"); // display computation progress at each percent
+                break;
             }
     }
 
     PutRNGstate(); // no RNs required anymore
 
+    // the sampling frequencies are relative to the iterations actually done,
+    // which are fewer than chainlength if the chain stopped early
+    const bool stoppedEarly = (t != bookkeep.chainlength);
+    bookkeep.chainlength = t;
 
     // normalize posterior probabilities and correct log marg lik and log prior
     const long double logNormConst = modelCache.getLogNormConstant();
@@ -1041,9 +1532,17 @@ glmSampling(const DataValues& data,
     ret.attr("numVisited") = modelCache.size();
     ret.attr("inclusionProbs") = modelCache.getInclusionProbs(logNormConst, fpInfo.nFps, ucInfo.nUcGroups);
     ret.attr("logNormConst") = logNormConst;
+    ret.attr("samplerDiagnostics") = diagnostics.convert2list();
+    ret.attr("chainlength") = static_cast<double>(t);
+    ret.attr("stopReason") = anytimeStop.getReason();
 
     if (bookkeep.verbose){
+        if(stoppedEarly)
+        {
+            Rprintf("\nChain stopped after %lu iterations (%s)", t, anytimeStop.getReason().c_str());
+        }
         Rprintf("\nNumber of non-identifiable model proposals:     %d", bookkeep.nanCounter);
+        Rprintf("\nNumber of Laplace-only models:                  %lu", bookkeep.laplaceOnlyCounter);
         Rprintf("\nNumber of total cached models:                  %d", modelCache.size());
         Rprintf("\nNumber of returned models:                      %d\n", Rf_length(ret));
     }
@@ -1063,7 +1562,9 @@ glmExhaustive(const DataValues& data,
               const FixInfo& fixInfo,
               Book& bookkeep,
               const GlmModelConfig& config,
-              const GaussHermite& gaussHermite)
+              const GaussHermite& gaussHermite,
+              ModelStore& store,
+              bool grayCode)
 {
     // no map needed for exhaustive search, a set is the right thing:
     set<Model> orderedModels;
@@ -1094,7 +1595,7 @@ glmExhaustive(const DataValues& data,
     // otherwise it comes later
     if(fixInfo.nFixGroups != 0)
       computeGlm(startModel, orderedModels,
-               data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+               data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
     
     // add the fixed covariates to the model configuration
     IntSet s;
@@ -1104,8 +1605,38 @@ glmExhaustive(const DataValues& data,
       
     
     // start computation
-    glmPermPars(0, startModel, orderedModels,
-                data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+    if(grayCode)
+    {
+        // all power multisets of each FP, starting with the empty one
+        std::vector<PowersVector> fpValues(fpInfo.nFps);
+        for (PosInt i = 0; i != fpInfo.nFps; i++)
+        {
+            const PosInt card = fpInfo.fpcards.at(i);
+            fpValues[i].push_back(Powers());
+            for (PosInt deg = 1; deg <= fpInfo.fpmaxs.at(i); deg++)
+            {
+                IntVector part (card);
+                bool more = false;
+                int h(0), t(0);
+                do
+                {
+                    comp_next(deg, card, part, &more, h, t);
+                    fpValues[i].push_back(freqvec2Powers(part, card));
+                }
+                while (more);
+            }
+        }
+        std::vector<bool> forward(fpInfo.nFps + ucInfo.nUcGroups, true);
+        AVector linPredWarmStart;
+
+        glmGrayPermPars(0, fpValues, forward, startModel, linPredWarmStart, orderedModels,
+                        data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
+    }
+    else
+    {
+        glmPermPars(0, startModel, orderedModels,
+                    data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store);
+    }
 
     // we have finished.
 
@@ -1116,6 +1647,8 @@ glmExhaustive(const DataValues& data,
                 bookkeep.modelCounter);
         Rprintf("\nNumber of non-identifiable models: %d",
                 bookkeep.nanCounter);
+        Rprintf("\nNumber of Laplace-only models:     %lu",
+                bookkeep.laplaceOnlyCounter);
         Rprintf("\nNumber of saved possible models:   %d\n",
                 orderedModels.size());
     }
@@ -1158,6 +1691,107 @@ glmExhaustive(const DataValues& data,
 
 // ***************************************************************************************************//
 
+// time the hot kernels of the model search separately for the models in the R-list
+// "rcpp_modelConfigs": the design matrix construction, the IWLS iterations (for GLMs) or the Cox fit
+// (for Cox models), and the whole log marginal likelihood approximation.
+// Returns a list with the kernel names, the numbers of calls and the seconds needed for them.
+List
+glmKernelBenchmark(const DataValues& data,
+                   const FpInfo& fpInfo,
+                   const UcInfo& ucInfo,
+                   const FixInfo& fixInfo,
+                   const Book& bookkeep,
+                   const GlmModelConfig& config,
+                   const GaussHermite& gaussHermite,
+                   const List& rcpp_modelConfigs)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    // the models, without the null model which has no kernels to time
+    vector<ModelPar> models;
+    for(R_len_t i = 0; i < rcpp_modelConfigs.size(); ++i)
+    {
+        ModelPar mod(as<List>(rcpp_modelConfigs[i]), fpInfo);
+        if(mod.size(ucInfo, fixInfo) > 0)
+        {
+            models.push_back(mod);
+        }
+    }
+
+    StrVector kernels;
+    MyDoubleVector calls;
+    MyDoubleVector seconds;
+
+    // the design matrices
+    Clock::time_point start = Clock::now();
+    for(vector<ModelPar>::const_iterator m = models.begin(); m != models.end(); ++m)
+    {
+        getDesignMatrix(*m, data, fpInfo, ucInfo, fixInfo);
+    }
+    kernels.push_back("getDesignMatrix");
+    calls.push_back(models.size());
+    seconds.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+
+    // the IWLS iterations at g = 1 until convergence, or the Cox fits
+    double nIterations = 0.0;
+    start = Clock::now();
+    for(vector<ModelPar>::const_iterator m = models.begin(); m != models.end(); ++m)
+    {
+        R_CheckUserInterrupt();
+
+        try
+        {
+            if(bookkeep.doGlm)
+            {
+                Iwls iwls(*m, data, fpInfo, ucInfo, fixInfo, config, config.linPredStart,
+                          true, EPS, false, bookkeep.tbf);
+                nIterations += iwls.startWithNewLinPred(40, 1.0, config.linPredStart);
+            }
+            else
+            {
+                Coxfit cox(data.response,
+                           data.censInd,
+                           getDesignMatrix(*m, data, fpInfo, ucInfo, fixInfo, false),
+                           config.weights,
+                           config.offsets,
+                           1);
+                cox.computeResidualDeviance();
+                nIterations += 1.0;
+            }
+        }
+        catch (std::domain_error& error)
+        {
+            // non-identifiable models are not timed separately
+        }
+    }
+    kernels.push_back(bookkeep.doGlm ? "Iwls" : "Coxfit");
+    calls.push_back(nIterations);
+    seconds.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+
+    // the log marginal likelihood approximations, each with a new cache
+    start = Clock::now();
+    for(vector<ModelPar>::const_iterator m = models.begin(); m != models.end(); ++m)
+    {
+        Cache cache;
+        double zMode = R_NaReal;
+        double zVar = R_NaReal;
+        double laplaceApprox = R_NaReal;
+        double residualDeviance = R_NaReal;
+
+        getGlmVarLogMargLik(*m, data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite,
+                            cache, zMode, zVar, laplaceApprox, residualDeviance);
+    }
+    kernels.push_back("getGlmVarLogMargLik");
+    calls.push_back(models.size());
+    seconds.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+
+    return List::create(_["kernel"] = kernels,
+                        _["calls"] = calls,
+                        _["seconds"] = seconds);
+}
+
+// ***************************************************************************************************//
+
 // 21/11/2012: add tbf option
 // 03/12/2012: add Cox regression with tbfs
 // 03/07/2013: remove nullModelInfo and only get nullModelLogMargLik
@@ -1209,16 +1843,17 @@ cpp_glmBayesMfp(List rcpp_data, List rcpp_fpInfos, List rcpp_ucInfos, List rcpp_
     // ----------------------------------------------------------------------------------
 
     // data:
+    // (the Armadillo objects are views of the R memory, nothing is copied)
     const NumericMatrix n_x = rcpp_data["x"];
-    const AMatrix x(n_x.begin(), n_x.nrow(),
-                   n_x.ncol());
+    const AMatrix x = shareMatrix(n_x.begin(), n_x.nrow(),
+                                  n_x.ncol());
 
     const NumericMatrix n_xCentered = rcpp_data["xCentered"];
-    const AMatrix xCentered(n_xCentered.begin(), n_xCentered.nrow(),
-                           n_xCentered.ncol());
+    const AMatrix xCentered = shareMatrix(n_xCentered.begin(), n_xCentered.nrow(),
+                                          n_xCentered.ncol());
 
     const NumericVector n_y = rcpp_data["y"];
-    const AVector y(n_y.begin(), n_y.size());
+    const AVector y = shareVector(n_y.begin(), n_y.size());
 
     const IntVector censInd = as<IntVector>(rcpp_data["censInd"]);
 
@@ -1306,6 +1941,8 @@ cpp_glmBayesMfp(List rcpp_data, List rcpp_fpInfos, List rcpp_ucInfos, List rcpp_
 #endif
     const GaussHermite gaussHermite(as<List>(rcpp_options["gaussHermite"]));
     const bool higherOrderCorrection = as<bool>(rcpp_options["higherOrderCorrection"]);
+    const bool singlePrecision = rcpp_options.containsElementNamed("singlePrecision") ?
+            as<bool>(rcpp_options["singlePrecision"]) : false;
 
 
     // ----------------------------------------------------------------------------------
@@ -1320,8 +1957,17 @@ cpp_glmBayesMfp(List rcpp_data, List rcpp_fpInfos, List rcpp_ucInfos, List rcpp_
 
     const DataValues data(x, xCentered, y, censInd, totalNumber, fixedCols);
 
+    if(verbose)
+    {
+        MemoryReport memory;
+        memory.add(data.design);
+        memory.add(data.centeredDesign);
+        memory.add(data.response);
+        memory.print("cpp_glmBayesMfp");
+    }
+
     // FP configuration:
-    const FpInfo fpInfo(fpcards, fppos, fpmaxs, fpnames, x);
+    const FpInfo fpInfo(fpcards, fppos, fpmaxs, fpnames, x, singlePrecision);
 
     // UC configuration:
 
@@ -1336,7 +1982,7 @@ cpp_glmBayesMfp(List rcpp_data, List rcpp_fpInfos, List rcpp_ucInfos, List rcpp_
         maxUcDim += thisSize;
         ucSizes.push_back(thisSize);
     }
-    const UcInfo ucInfo(ucSizes, maxUcDim, ucIndices, ucColList);
+    const UcInfo ucInfo(ucSizes, maxUcDim, ucIndices, ucColList, xCentered);
 
 
 	// Fix configuration:
@@ -1372,7 +2018,13 @@ cpp_glmBayesMfp(List rcpp_data, List rcpp_fpInfos, List rcpp_ucInfos, List rcpp_
                   largeVariance,
                   useBfgs,
                   debug,
-                  higherOrderCorrection);
+                  higherOrderCorrection,
+                  rcpp_searchConfig.containsElementNamed("zCachePoints") ?
+                          as<PosInt>(rcpp_searchConfig["zCachePoints"]) : 0,
+                  rcpp_searchConfig.containsElementNamed("quadratureTolerance") ?
+                          as<double>(rcpp_searchConfig["quadratureTolerance"]) : 0.0,
+                  rcpp_searchConfig.containsElementNamed("laplaceThreshold") ?
+                          as<double>(rcpp_searchConfig["laplaceThreshold"]) : R_PosInf);
 
     // model configuration:
     const GlmModelConfig config(rcpp_family, nullModelLogMargLik, nullModelDeviance, fixedg, rcpp_gPrior,
@@ -1390,22 +2042,94 @@ cpp_glmBayesMfp(List rcpp_data, List rcpp_fpInfos, List rcpp_ucInfos, List rcpp_
     }
 #endif
 
+    // the persistent store of the models computed in earlier runs
+    // (this option is missing in the search configuration of older model objects)
+    ModelStore store(rcpp_searchConfig.containsElementNamed("modelStoreFile") ?
+                             as<std::string>(rcpp_searchConfig["modelStoreFile"]) : std::string(),
+                     rcpp_searchConfig.containsElementNamed("modelStoreKey") ?
+                             as<RawVector>(rcpp_searchConfig["modelStoreKey"]) : RawVector(0));
+
     // ----------------------------------------------------------------------------------
     // now either compute only one Model, do model sampling or do an exhaustive search
     // ----------------------------------------------------------------------------------
 
-    if(onlyComputeModelsInList)
+    // count and time the phases of this search from scratch
+    perfCounters.reset();
+
+    List ret;
+    if(rcpp_searchConfig.containsElementNamed("kernelBenchmark"))
+    {
+        // only time the kernels for the models in the list
+        return glmKernelBenchmark(data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite,
+                                  as<List>(rcpp_searchConfig["modelConfigs"]));
+    }
+    else if(onlyComputeModelsInList)
     {
-        return glmModelsInList(data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, as<List>(rcpp_searchConfig["modelConfigs"]));
+        ret = glmModelsInList(data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store, as<List>(rcpp_searchConfig["modelConfigs"]));
     }
     else if(doSampling)
     {
-        return glmSampling(data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+        // (this option is only read here, because it is not needed to compute single models)
+        const bool legacyRng = as<bool>(rcpp_options["legacyRng"]);
+        const PosLargeInt adaptationLength =
+                rcpp_searchConfig.containsElementNamed("adaptationLength") ?
+                        static_cast<PosLargeInt>(as<double>(rcpp_searchConfig["adaptationLength"])) : 0;
+        const MyDoubleVector temperatures =
+                rcpp_searchConfig.containsElementNamed("temperatures") ?
+                        as<MyDoubleVector>(rcpp_searchConfig["temperatures"]) : MyDoubleVector(1, 1.0);
+        const PosLargeInt swapInterval =
+                rcpp_searchConfig.containsElementNamed("swapInterval") ?
+                        static_cast<PosLargeInt>(as<double>(rcpp_searchConfig["swapInterval"])) : 1;
+        const CheckpointOptions checkpoint(
+                rcpp_searchConfig.containsElementNamed("checkpointFile") ?
+                        as<std::string>(rcpp_searchConfig["checkpointFile"]) : std::string(),
+                rcpp_searchConfig.containsElementNamed("checkpointInterval") ?
+                        static_cast<PosLargeInt>(as<double>(rcpp_searchConfig["checkpointInterval"])) : 1,
+                rcpp_searchConfig.containsElementNamed("resume") ?
+                        as<bool>(rcpp_searchConfig["resume"]) : false);
+        AnytimeStop anytimeStop(
+                rcpp_searchConfig.containsElementNamed("maxSeconds") ?
+                        as<double>(rcpp_searchConfig["maxSeconds"]) : R_PosInf,
+                rcpp_searchConfig.containsElementNamed("maxEvaluations") ?
+                        as<double>(rcpp_searchConfig["maxEvaluations"]) : R_PosInf,
+                rcpp_searchConfig.containsElementNamed("convergenceEpsilon") ?
+                        as<double>(rcpp_searchConfig["convergenceEpsilon"]) : 0.0,
+                rcpp_searchConfig.containsElementNamed("convergenceWindow") ?
+                        static_cast<PosLargeInt>(as<double>(rcpp_searchConfig["convergenceWindow"])) : 10000,
+                fpInfo.nFps + ucInfo.nUcGroups);
+        RngStream rng = getRngStream(legacyRng);
+        ret = glmSampling(data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, adaptationLength,
+                          temperatures, swapInterval, checkpoint, anytimeStop, store, rng);
     }
     else
     {
-        return glmExhaustive(data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite);
+        // minimal change order of the models?
+        // (this option is missing in the search configuration of older model objects)
+        const bool grayCode =
+                rcpp_searchConfig.containsElementNamed("grayCode") ?
+                        as<bool>(rcpp_searchConfig["grayCode"]) : false;
+        ret = glmExhaustive(data, fpInfo, ucInfo, fixInfo, bookkeep, config, gaussHermite, store, grayCode);
     }
+
+    // save the newly computed models for later runs
+    if(store.active())
+    {
+        store.flush();
+        ret.attr("modelStore") = store.convert2list();
+    }
+
+    // the number of models with only the Laplace approximation
+    ret.attr("numLaplaceOnly") = static_cast<double>(bookkeep.laplaceOnlyCounter);
+
+    // the performance counters and phase timers
+    ret.attr("perfCounters") = perfCounters.convert2list();
+
+    if(verbose)
+    {
+        Rprintf("\ncpp_glmBayesMfp: peak resident memory %.1f MB\n", peakResidentMegabytes());
+    }
+
+    return ret;
 }
 
 // ***************************************************************************************************//
@@ -34,6 +34,14 @@ struct GPrior
     {
         return R_NaReal;
     }
+
+    // can logDens be called from several threads at the same time?
+    // (not if it calls back to R)
+    virtual bool
+    isThreadSafe() const
+    {
+        return true;
+    }
 };
 
 // ***************************************************************************************************//
@@ -134,6 +142,13 @@ public:
         return wrappedRfunction(g);
     }
 
+    // the R function must not be called from other threads
+    bool
+    isThreadSafe() const
+    {
+        return false;
+    }
+
 private:
     // the wrapped R function
     const RFunction wrappedRfunction;
@@ -9,20 +9,30 @@
 
 /* .Call calls */
 extern SEXP _glmBfp_cpp_bfgs(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
+extern SEXP _glmBfp_cpp_columnFileInfo(SEXP);
 extern SEXP _glmBfp_cpp_coxfit(SEXP, SEXP, SEXP, SEXP, SEXP);
+extern SEXP _glmBfp_cpp_empiricalHpds(SEXP, SEXP);
 extern SEXP _glmBfp_cpp_evalZdensity(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
 extern SEXP _glmBfp_cpp_glmBayesMfp(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
-extern SEXP _glmBfp_cpp_optimize(SEXP, SEXP, SEXP, SEXP);
+extern SEXP _glmBfp_cpp_optimize(SEXP, SEXP, SEXP, SEXP, SEXP);
 extern SEXP _glmBfp_cpp_sampleGlm(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
+extern SEXP _glmBfp_cpp_scrHpd(SEXP, SEXP, SEXP);
+extern SEXP _glmBfp_cpp_streamCox(SEXP, SEXP, SEXP);
+extern SEXP _glmBfp_cpp_streamGlm(SEXP, SEXP, SEXP, SEXP);
 extern SEXP _glmBfp_predBMAcpp(SEXP, SEXP, SEXP);
 
 static const R_CallMethodDef CallEntries[] = {
     {"_glmBfp_cpp_bfgs",         (DL_FUNC) &_glmBfp_cpp_bfgs,         6},
+    {"_glmBfp_cpp_columnFileInfo", (DL_FUNC) &_glmBfp_cpp_columnFileInfo, 1},
     {"_glmBfp_cpp_coxfit",       (DL_FUNC) &_glmBfp_cpp_coxfit,       5},
+    {"_glmBfp_cpp_empiricalHpds", (DL_FUNC) &_glmBfp_cpp_empiricalHpds, 2},
     {"_glmBfp_cpp_evalZdensity", (DL_FUNC) &_glmBfp_cpp_evalZdensity, 7},
     {"_glmBfp_cpp_glmBayesMfp",  (DL_FUNC) &_glmBfp_cpp_glmBayesMfp,  7},
-    {"_glmBfp_cpp_optimize",     (DL_FUNC) &_glmBfp_cpp_optimize,     4},
+    {"_glmBfp_cpp_optimize",     (DL_FUNC) &_glmBfp_cpp_optimize,     5},
     {"_glmBfp_cpp_sampleGlm",    (DL_FUNC) &_glmBfp_cpp_sampleGlm,    9},
+    {"_glmBfp_cpp_scrHpd",       (DL_FUNC) &_glmBfp_cpp_scrHpd,       3},
+    {"_glmBfp_cpp_streamCox",    (DL_FUNC) &_glmBfp_cpp_streamCox,    3},
+    {"_glmBfp_cpp_streamGlm",    (DL_FUNC) &_glmBfp_cpp_streamGlm,    4},
     {"_glmBfp_predBMAcpp",       (DL_FUNC) &_glmBfp_predBMAcpp,       3},
     {NULL, NULL, 0}
 };
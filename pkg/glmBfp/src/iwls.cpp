@@ -8,7 +8,10 @@
 #include <design.h>
 #include <stdexcept>
 #include <sstream>
+#include <algorithm>
+#include <utility>
 #include <linalgInterface.h>
+#include <perfCounters.h>
 
 // criterion for comparison of two Column vectors of the same size
 // max_j (abs(a_j - b_j) / abs(b_j) + 0.01)
@@ -42,6 +45,55 @@ criterion(const AVector& a, const AVector& b)
 }
 
 
+// the products with the design matrix X in single precision, where blocks of rows are
+// converted to double precision. So only the single precision matrix is read from
+// the memory, while all sums are accumulated in double precision.
+static const PosInt singleBlockSize = 256;
+
+// C := X' diag(sqrtWeights)^2 X + beta * C (lower triangle) and
+// Xtv := X' diag(sqrtWeights) v
+static void
+singleWeightedCrossprod(const SMatrix& X,
+                        const AVector& sqrtWeights,
+                        const AVector& v,
+                        double beta,
+                        AMatrix& C,
+                        AVector& Xtv)
+{
+    Xtv.zeros(X.n_cols);
+
+    for(PosInt first = 0; first < X.n_rows; first += singleBlockSize)
+    {
+        const PosInt last = std::min<PosInt>(first + singleBlockSize, X.n_rows) - 1;
+
+        AMatrix block = arma::conv_to<AMatrix>::from(X.rows(first, last));
+        block.each_col() %= sqrtWeights.rows(first, last);
+
+        syrk(false,
+             true,
+             block,
+             (first == 0) ? beta : 1.0,
+             C);
+        Xtv += arma::trans(block) * v.rows(first, last);
+    }
+}
+
+// X * b
+static AMatrix
+singleTimes(const SMatrix& X,
+            const AMatrix& b)
+{
+    AMatrix ret(X.n_rows, b.n_cols);
+
+    for(PosInt first = 0; first < X.n_rows; first += singleBlockSize)
+    {
+        const PosInt last = std::min<PosInt>(first + singleBlockSize, X.n_rows) - 1;
+        ret.rows(first, last) = arma::conv_to<AMatrix>::from(X.rows(first, last)) * b;
+    }
+
+    return ret;
+}
+
 // constructor: constructs the Iwls object for given model and data.
 Iwls::Iwls(const ModelPar &mod,
            const DataValues& data,
@@ -54,11 +106,38 @@ Iwls::Iwls(const ModelPar &mod,
            double epsilon,
            bool debug,
            bool tbf) :
-           design(getDesignMatrix(mod, data, fpInfo, ucInfo, fixInfo)),
-           nCoefs(design.n_cols),
+           Iwls(getDesignMatrix(mod, data, fpInfo, ucInfo, fixInfo),
+                mod,
+                data,
+                fpInfo,
+                ucInfo,
+                config,
+                linPredStart,
+                conditional,
+                epsilon,
+                tbf)
+{
+}
+
+// the actual constructor: in single precision, fullDesign is only used here
+// and not kept in double precision.
+Iwls::Iwls(AMatrix&& fullDesign,
+           const ModelPar &mod,
+           const DataValues& data,
+           const FpInfo& fpInfo,
+           const UcInfo& ucInfo,
+           const GlmModelConfig& config,
+           const AVector& linPredStart,
+           bool conditional,
+           double epsilon,
+           bool tbf) :
+           nCoefs(fullDesign.n_cols),
            isNullModel(nCoefs == 1),
            useFixedZ(conditional),
-           nObs(design.n_rows),
+           nObs(fullDesign.n_rows),
+           designSingle(fpInfo.singlePrecision ? arma::conv_to<SMatrix>::from(fullDesign) : SMatrix()),
+           design(fpInfo.singlePrecision ? AMatrix() : std::move(fullDesign)),
+           structuredDesign(fpInfo.singlePrecision ? fullDesign : design, mod, fpInfo, ucInfo),
            // not possible because this could be the null model: designWithoutIntercept(nObs, nCoefs - 1),
            response(data.response),
            config(config),
@@ -69,6 +148,9 @@ Iwls::Iwls(const ModelPar &mod,
            // verbose(debug),
            tbf(tbf)
 {
+    // the design matrix in double precision, which is still there during the construction
+    const AMatrix& X = fpInfo.singlePrecision ? fullDesign : design;
+
     // only do additional computations if not the TBF methodology is used
     if(! tbf)
     {
@@ -80,7 +162,7 @@ Iwls::Iwls(const ModelPar &mod,
             // Scaled design matrix without the intercept.
             // This will be diag(dispersions)^(-1/2) * design[, -1]
             // (attention with 0-based indexing of Armadillo objects!)
-            AMatrix scaledDesignWithoutIntercept = arma::diagmat(invSqrtDispersions) * design.cols(1, nCoefs - 1);
+            AMatrix scaledDesignWithoutIntercept = arma::diagmat(invSqrtDispersions) * X.cols(1, nCoefs - 1);
 
             // then the log of the determinant of B'(dispersions)^(-1)B, which is part of the submatrix of R^-1
             // (we know that B'(dispersions)^(-1)B is positive definite, so we do not need to check the sign of the determinant)
@@ -99,7 +181,7 @@ Iwls::Iwls(const ModelPar &mod,
                                           resultsFisher,
                                           config,
                                           response,
-                                          design,
+                                          X,
                                           epsilon,
                                           unscaledPriorPrec
               ); //an alternative to using the X'X covariance matrix
@@ -126,6 +208,8 @@ Iwls::Iwls(const ModelPar &mod,
             // check that all went well
             if(info != 0)
             {
+                perfCounters.increment(PerfCounters::choleskyFailures);
+
                 std::ostringstream stream;
                 stream << "dpotrf(scaledDesignWithoutInterceptCrossprod) got error code " << info << "in Iwls constructor";
                 throw std::domain_error(stream.str().c_str());
@@ -156,6 +240,8 @@ PosInt
 Iwls::startWithLastLinPred(PosInt maxIter,
                               double g)
 {
+    PhaseTimer timer(PerfCounters::iwlsPhase);
+
     // initialize iteration counter and stopping criterion
     PosInt iter = 0;
     bool converged = false;
@@ -163,6 +249,8 @@ Iwls::startWithLastLinPred(PosInt maxIter,
     // do IWLS for at most 30 iterations and unfulfilled stopping criterion
     while ((iter++ < maxIter) && (! converged))
     {
+        perfCounters.increment(PerfCounters::iwlsIterations);
+
         // compute the pseudo-observations and corresponding sqrt(weights) from the linear predictor
         AVector pseudoObs(nObs);
         AVector sqrtWeights(invSqrtDispersions);
@@ -177,9 +265,6 @@ Iwls::startWithLastLinPred(PosInt maxIter,
             sqrtWeights(i) *= dmudEta / sqrt(config.distribution->variance(mu));
         }
 
-        // calculate X'sqrt(W), which is needed twice
-        AMatrix XtsqrtW = arma::trans(design) * arma::diagmat(sqrtWeights);
-
         // calculate the precision matrix Q by doing a rank update:
         // if full Bayes is used, then:
         // Q = tcrossprod(X'sqrt(W)) + 1/g * unscaledPriorPrec
@@ -187,11 +272,43 @@ Iwls::startWithLastLinPred(PosInt maxIter,
         // Q = tcrossprod(X'sqrt(W))
         double scaleFactor = tbf ? 0.0 : 1.0 / g;
         results.qFactor = unscaledPriorPrec;
-        syrk(false,
-             false,
-             XtsqrtW,
-             scaleFactor,
-             results.qFactor);
+
+        // X'sqrt(W) is only needed for the dense design matrix
+        AMatrix XtsqrtW;
+
+        // the scaled pseudo observations sqrt(W) * pseudoObs
+        pseudoObs = arma::diagmat(sqrtWeights) * pseudoObs;
+
+        // in single precision, the rhs below is computed in the same pass as Q
+        AVector singleRhs;
+
+        if(structuredDesign.hasFactors())
+        {
+            structuredDesign.weightedCrossprod(arma::square(sqrtWeights),
+                                               scaleFactor,
+                                               results.qFactor);
+        }
+        else if(! designSingle.is_empty())
+        {
+            // single precision storage: Q and the rhs together in one pass over the design
+            singleWeightedCrossprod(designSingle,
+                                    sqrtWeights,
+                                    pseudoObs,
+                                    scaleFactor,
+                                    results.qFactor,
+                                    singleRhs);
+        }
+        else
+        {
+            // calculate X'sqrt(W), which is needed twice
+            XtsqrtW = arma::trans(design) * arma::diagmat(sqrtWeights);
+
+            syrk(false,
+                 false,
+                 XtsqrtW,
+                 scaleFactor,
+                 results.qFactor);
+        }
 
         // decompose into Cholesky factor, Q = LL':
         int info = potrf(false,
@@ -200,6 +317,8 @@ Iwls::startWithLastLinPred(PosInt maxIter,
         // check that no error occured
         if(info != 0)
         {
+            perfCounters.increment(PerfCounters::choleskyFailures);
+
             std::ostringstream stream;
             stream << "Cholesky factorization Q = LL' got error code " << info <<
                     " in IWLS iteration " << iter;
@@ -214,8 +333,18 @@ Iwls::startWithLastLinPred(PosInt maxIter,
         AVector coefs_old = results.coefs;
 
         // the rhs of the equation Q * m = rhs   or    R'R * m = rhs
-        pseudoObs = arma::diagmat(sqrtWeights) * pseudoObs;
-        results.coefs = XtsqrtW * pseudoObs;
+        if(structuredDesign.hasFactors())
+        {
+            results.coefs = structuredDesign.transTimes(sqrtWeights % pseudoObs);
+        }
+        else if(! designSingle.is_empty())
+        {
+            results.coefs = singleRhs;
+        }
+        else
+        {
+            results.coefs = XtsqrtW * pseudoObs;
+        }
         // note that we have some steps to go until the computation
         // of results.coefs is finished!
 
@@ -238,7 +367,18 @@ Iwls::startWithLastLinPred(PosInt maxIter,
         }
 
         // the new linear predictor is
-        results.linPred = design * results.coefs + config.offsets;
+        if(structuredDesign.hasFactors())
+        {
+            results.linPred = structuredDesign.times(results.coefs) + config.offsets;
+        }
+        else if(! designSingle.is_empty())
+        {
+            results.linPred = singleTimes(designSingle, results.coefs) + config.offsets;
+        }
+        else
+        {
+            results.linPred = design * results.coefs + config.offsets;
+        }
 
         // compare on the coefficients scale, but not in the first iteration where
         // it is not clear from where coefs_old came. Be safe and always
@@ -281,7 +421,35 @@ Iwls::startWithNewCoefs(PosInt maxIter,
                   const AVector& coefsStart)
 {
     // start with new linpred deriving from the coefs
-    return startWithNewLinPred(maxIter, g, design * coefsStart + config.offsets);
+    return startWithNewLinPred(maxIter, g, designTimes(coefsStart) + config.offsets);
+}
+
+// X * b for the columns b, from the design matrix in the stored precision
+AMatrix
+Iwls::designTimes(const AMatrix& b) const
+{
+    if(designSingle.is_empty())
+    {
+        return design * b;
+    }
+    else
+    {
+        return singleTimes(designSingle, b);
+    }
+}
+
+// row i of the design matrix, as column vector in double precision
+AVector
+Iwls::designRow(PosInt i) const
+{
+    if(designSingle.is_empty())
+    {
+        return arma::trans(design.row(i));
+    }
+    else
+    {
+        return arma::conv_to<AVector>::from(arma::trans(designSingle.row(i)));
+    }
 }
 
 // 03/07/2013: add offsets
@@ -299,8 +467,34 @@ double
 Iwls::computeLogUnPosteriorDens(const Parameter& sample) const
 {
     // compute the sample of the linear predictor:
-    AVector linPredSample = design * sample.coefs + config.offsets;
+    const AVector linPredSample = designTimes(sample.coefs) + config.offsets;
 
+    return computeLogUnPosteriorDensFromLinPred(linPredSample, sample.coefs(0), sample.z);
+}
+
+// the same for many samples at once
+AVector
+Iwls::computeLogUnPosteriorDens(const AMatrix& coefs,
+                                const AVector& z) const
+{
+    // all samples of the linear predictor with one matrix product:
+    AMatrix linPredSamples = designTimes(coefs);
+    linPredSamples.each_col() += config.offsets;
+
+    AVector ret(coefs.n_cols);
+    for(PosInt j = 0; j < coefs.n_cols; ++j)
+    {
+        ret(j) = computeLogUnPosteriorDensFromLinPred(linPredSamples.col(j), coefs(0, j), z(j));
+    }
+
+    return ret;
+}
+
+double
+Iwls::computeLogUnPosteriorDensFromLinPred(const AVector& linPredSample,
+                                           double intercept,
+                                           double z) const
+{
     // compute the resulting mean vector from the linear predictor via the response function
     AVector meansSample(linPredSample.n_elem);
 
@@ -321,10 +515,10 @@ Iwls::computeLogUnPosteriorDens(const Parameter& sample) const
     if(! isNullModel)
     {
         // map z sample on the original g scale
-        double g = exp(sample.z);
+        double g = exp(z);
 
         // calculate ||(dispersions)^(-1/2) * B * beta||^2
-        AVector scaledBcoefsSample = arma::diagmat(invSqrtDispersions) * (linPredSample - sample.coefs(0));
+        AVector scaledBcoefsSample = arma::diagmat(invSqrtDispersions) * (linPredSample - intercept);
 
         // this avoids this multiplication of general matrices:
         // "DEVector scaledBcoefsSample = scaledDesignWithoutIntercept * sample.coefs(_(2, nCoefs));"
@@ -334,7 +528,7 @@ Iwls::computeLogUnPosteriorDens(const Parameter& sample) const
         // the coefficients
         ret += 0.5 * (logScaledDesignWithoutInterceptCrossprodDeterminant -
                       scaledBcoefsSampleNormSquared / (g * config.cfactor) -
-                     (nCoefs - 1.0) * (2.0 * M_LN_SQRT_2PI + sample.z + log(config.cfactor)));
+                     (nCoefs - 1.0) * (2.0 * M_LN_SQRT_2PI + z + log(config.cfactor)));
 
         if(! useFixedZ)
         {
@@ -342,9 +536,9 @@ Iwls::computeLogUnPosteriorDens(const Parameter& sample) const
             double logGPrior = config.gPrior->logDens(g);
 
             // add the log prior of z
-            ret += logGPrior + sample.z;
+            ret += logGPrior + z;
 
-            // note that the sample.z has its origin in the density transformation from g to z.
+            // note that the z has its origin in the density transformation from g to z.
             // if the prior on g was discrete and not continuous, this part would not be included in general.
         }
     }
@@ -393,7 +587,7 @@ Iwls::computeDeviance(PosInt maxIter)
 // Compute a standard GLM to get the observed Fisher Information to use as covariance matrix.
 AMatrix 
 Iwls::getInformation(PosInt maxIter, PosInt nObs, AVector invSqrtDispersions, IwlsResults results,
-          const GlmModelConfig& config, const AVector& response, const AMatrix design,
+          const GlmModelConfig& config, const AVector& response, const AMatrix& design,
           double epsilon, AMatrix unscaledPriorPrec)
 {
   
@@ -443,6 +637,8 @@ Iwls::getInformation(PosInt maxIter, PosInt nObs, AVector invSqrtDispersions, Iw
     // check that no error occured
     if(info != 0)
     {
+      perfCounters.increment(PerfCounters::choleskyFailures);
+
       std::ostringstream stream;
       stream << "Cholesky factorization Q = LL' got error code " << info <<
         " in IWLS iteration " << iter;
@@ -124,6 +124,12 @@ public:
     double
     computeLogUnPosteriorDens(const Parameter& sample) const;
 
+    // the same for many samples at once: the columns of coefs and the corresponding z values.
+    // The linear predictors are computed with one matrix product.
+    AVector
+    computeLogUnPosteriorDens(const AMatrix& coefs,
+                              const AVector& z) const;
+
     // compute the deviance of the current model, which in R is done by the glm.fit function
     // This is required to compute the TBF.
     // Note that this changes the Iwls object, because it iterates until convergence
@@ -145,15 +151,20 @@ public:
                            IwlsResults results,
                            const GlmModelConfig& config,
                            const AVector& response,
-                           const AMatrix design,
+                           const AMatrix& design,
                            double epsilon,
                            AMatrix unscaledPriorPrec
     );
     
-    // this can be public:
+    // X * b for the columns b, from the design matrix in the stored precision
+    AMatrix
+    designTimes(const AMatrix& b) const;
 
-    // design matrix for this model
-    const AMatrix design;
+    // row i of the design matrix, as column vector in double precision
+    AVector
+    designRow(PosInt i) const;
+
+    // this can be public:
 
     // dimension including the intercept ("ncol(design)" in R syntax)
     const PosInt nCoefs;
@@ -167,9 +178,39 @@ public:
     // number of observations
     const PosInt nObs;
 
+    // the design matrix in single precision, if the FpInfo asks for that (otherwise empty).
+    // Then the IWLS iterations without factors stream this matrix.
+    const SMatrix designSingle;
+
+    // design matrix for this model in double precision (empty if designSingle is used)
+    const AMatrix design;
+
+    // and the same with the factors in level code form, for the IWLS iterations
+    // (this only keeps the dense columns in double precision)
+    const StructuredDesign structuredDesign;
+
 
 private:
 
+    // the actual constructor, which gets the full design matrix in double precision.
+    // It is moved into design, or only used during the construction if designSingle is used.
+    Iwls(AMatrix&& fullDesign,
+         const ModelPar &mod,
+         const DataValues& data,
+         const FpInfo& fpInfo,
+         const UcInfo& ucInfo,
+         const GlmModelConfig& config,
+         const AVector& linPredStart,
+         bool conditional,
+         double epsilon,
+         bool tbf);
+
+    // compute the log of the (unnormalized) posterior density from the linear predictor
+    // (including offsets), the intercept and z of the sample
+    double
+    computeLogUnPosteriorDensFromLinPred(const AVector& linPredSample,
+                                         double intercept,
+                                         double z) const;
 
     // the log of the determinant of the crossproduct of scaledDesignWithoutIntercept
     // This is B'(dispersions)^(-1)B.
@@ -12,6 +12,7 @@
 #define LINKS_H_
 
 #include <rcppExport.h>
+#include <string>
 
 static const double THRESH = 30.;
 static const double MTHRESH = -30.;
@@ -292,4 +293,41 @@ public:
         return 1.0;
     }
 };
+
+// ***************************************************************************************************//
+
+// get a new link object for the link name, which must be deleted by the caller
+inline Link*
+newLink(const std::string& linkString)
+{
+    if (linkString == "logit")
+    {
+        return new LogitLink();
+    }
+    else if (linkString == "probit")
+    {
+        return new ProbitLink();
+    }
+    else if (linkString == "cloglog")
+    {
+        return new CloglogLink();
+    }
+    else if (linkString == "inverse")
+    {
+        return new InverseLink();
+    }
+    else if (linkString == "log")
+    {
+        return new LogLink();
+    }
+    else if (linkString == "identity")
+    {
+        return new IdentityLink();
+    }
+    else
+    {
+        Rcpp::stop("Link not implemented!");
+    }
+}
+
 #endif /* LINKS_H_ */
@@ -0,0 +1,52 @@
+/*
+ * memoryUsage.cpp
+ */
+
+#include <memoryUsage.h>
+#include <rcppExport.h>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// ***************************************************************************************************//
+
+double
+peakResidentMegabytes()
+{
+#ifdef _WIN32
+    return R_NaReal;
+#else
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return R_NaReal;
+
+#ifdef __APPLE__
+    // bytes on Mac OS X
+    return usage.ru_maxrss / 1048576.0;
+#else
+    // kilobytes on Linux and the BSDs
+    return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+// ***************************************************************************************************//
+
+void
+MemoryReport::print(const char* caller) const
+{
+    Rprintf("\n%s: data uses %.1f MB shared with R and %.1f MB of copies",
+            caller, sharedBytes / 1048576.0, ownedBytes / 1048576.0);
+
+    const double peak = peakResidentMegabytes();
+    if(! ISNA(peak))
+    {
+        Rprintf(", peak resident memory %.1f MB", peak);
+    }
+    Rprintf("\n");
+}
+
+// ***************************************************************************************************//
+
+// End of file.
@@ -0,0 +1,68 @@
+/*
+ * memoryUsage.h
+ */
+
+#ifndef MEMORYUSAGE_H_
+#define MEMORYUSAGE_H_
+
+#include <types.h>
+
+// ***************************************************************************************************//
+
+// non-owning views of memory which is owned by somebody else (R or another Armadillo
+// object), so nothing is copied. The caller must make sure that the owner stays
+// alive as long as the returned view is used.
+inline AMatrix
+shareMatrix(const double* mem, const PosInt nRows, const PosInt nCols)
+{
+    return AMatrix(const_cast<double*>(mem), nRows, nCols, false, true);
+}
+
+inline AVector
+shareVector(const double* mem, const PosInt nElem)
+{
+    return AVector(const_cast<double*>(mem), nElem, false, true);
+}
+
+// ***************************************************************************************************//
+
+// bookkeeping of the data path memory: what is shared with R and what has been copied.
+class MemoryReport
+{
+public:
+    MemoryReport() :
+        sharedBytes(0.0),
+        ownedBytes(0.0)
+        {}
+
+    // account for one Armadillo object
+    template<class T>
+    void
+    add(const T& object)
+    {
+        const double bytes = static_cast<double>(object.n_elem) * sizeof(double);
+        if(object.mem_state == 0)
+            ownedBytes += bytes;
+        else
+            sharedBytes += bytes;
+    }
+
+    // print the summary together with the peak resident memory so far
+    void
+    print(const char* caller) const;
+
+private:
+    double sharedBytes;
+    double ownedBytes;
+};
+
+// ***************************************************************************************************//
+
+// the high-water mark of the resident set size of this process in megabytes,
+// or NA if this is not available on the platform
+double
+peakResidentMegabytes();
+
+// ***************************************************************************************************//
+
+#endif /* MEMORYUSAGE_H_ */
@@ -0,0 +1,477 @@
+/*
+ * modelProposal.cpp
+ *
+ *  Twin of bfp/src/modelProposal.cpp: changes must be made in both files, which only differ
+ *  in the include style and the type names of the two packages.
+ */
+
+#include <modelProposal.h>
+#include <cmath>
+#include <algorithm>
+
+using namespace Rcpp;
+
+// ***************************************************************************************************//
+
+// share of the uniform distribution in the frozen weights, which keeps all
+// proposals possible however extreme the recorded frequencies are
+static const double uniformShare = 0.2;
+
+ProposalWeights::ProposalWeights(const PosIntVector& fpcards,
+                                 PosLargeInt nAdapt) :
+    fpcards(fpcards),
+    nAdapt(nAdapt),
+    frozen(false),
+    nRecorded(0),
+    inclusionCounts(fpcards.size() + 1, 0),
+    powerCounts(fpcards.size()),
+    inclusionWeights(),
+    powerWeights()
+{
+    for(PosInt i = 0; i != fpcards.size(); ++i)
+    {
+        powerCounts[i].resize(fpcards[i], 0);
+    }
+}
+
+// ***************************************************************************************************//
+
+void
+ProposalWeights::record(PosLargeInt t,
+                        const PowersVector& fpPars,
+                        bool ucPresent)
+{
+    if(frozen || (t >= nAdapt))
+        return;
+
+    ++nRecorded;
+
+    for(PosInt i = 0; i != fpPars.size(); ++i)
+    {
+        if(! fpPars[i].empty())
+            ++inclusionCounts[i];
+
+        for(Powers::const_iterator p = fpPars[i].begin(); p != fpPars[i].end(); ++p)
+            ++powerCounts[i][*p];
+    }
+
+    if(ucPresent)
+        ++inclusionCounts[fpPars.size()];
+
+    if(t + 1 == nAdapt)
+        freeze();
+}
+
+// ***************************************************************************************************//
+
+void
+ProposalWeights::freeze()
+{
+    // smoothed inclusion frequencies, shrunken towards 1/2
+    inclusionWeights.resize(inclusionCounts.size());
+    for(PosInt c = 0; c != inclusionCounts.size(); ++c)
+    {
+        const double freq = (inclusionCounts[c] + 1.0) / (nRecorded + 2.0);
+        inclusionWeights[c] = (1.0 - uniformShare) * freq + uniformShare * 0.5;
+    }
+
+    // smoothed power frequencies, shrunken towards the uniform distribution
+    powerWeights.resize(powerCounts.size());
+    for(PosInt i = 0; i != powerCounts.size(); ++i)
+    {
+        PosLargeInt total = 0;
+        for(PosInt k = 0; k != fpcards[i]; ++k)
+            total += powerCounts[i][k];
+
+        powerWeights[i].resize(fpcards[i]);
+        for(PosInt k = 0; k != fpcards[i]; ++k)
+        {
+            const double freq = (powerCounts[i][k] + 1.0) / (total + static_cast<double>(fpcards[i]));
+            powerWeights[i][k] = (1.0 - uniformShare) * freq + uniformShare / fpcards[i];
+        }
+    }
+
+    frozen = true;
+}
+
+void
+ProposalWeights::save(CheckpointWriter& checkpoint) const
+{
+    checkpoint.write(frozen);
+    checkpoint.write(nRecorded);
+    checkpoint.write(inclusionCounts);
+    checkpoint.write(powerCounts);
+    checkpoint.write(inclusionWeights);
+    checkpoint.write(powerWeights);
+}
+
+void
+ProposalWeights::restore(CheckpointReader& checkpoint)
+{
+    checkpoint.read(frozen);
+    checkpoint.read(nRecorded);
+    checkpoint.read(inclusionCounts);
+    checkpoint.read(powerCounts);
+    checkpoint.read(inclusionWeights);
+    checkpoint.read(powerWeights);
+}
+
+// ***************************************************************************************************//
+
+double
+ProposalWeights::birthWeightSum(const DenseIndexSet& covs) const
+{
+    if(! frozen)
+        return static_cast<double>(covs.size());
+
+    double ret = 0.0;
+    for(PosInt pos = 0; pos != covs.size(); ++pos)
+        ret += birthWeight(covs.at(pos));
+    return ret;
+}
+
+double
+ProposalWeights::deathWeightSum(const DenseIndexSet& covs) const
+{
+    if(! frozen)
+        return static_cast<double>(covs.size());
+
+    double ret = 0.0;
+    for(PosInt pos = 0; pos != covs.size(); ++pos)
+        ret += deathWeight(covs.at(pos));
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+PosInt
+ProposalWeights::drawWeighted(const DenseIndexSet& covs,
+                              const MyDoubleVector& weights,
+                              bool complement,
+                              RngStream& rng) const
+{
+    if(covs.empty())
+    {
+        Rcpp::stop("\nset in call to drawWeighted is empty!\n");
+    }
+
+    double total = 0.0;
+    for(PosInt pos = 0; pos != covs.size(); ++pos)
+    {
+        const double w = weights[covs.at(pos) - 1];
+        total += complement ? (1.0 - w) : w;
+    }
+
+    const double u = rng.unif() * total;
+
+    double cumsum = 0.0;
+    for(PosInt pos = 0; pos + 1 < covs.size(); ++pos)
+    {
+        const double w = weights[covs.at(pos) - 1];
+        cumsum += complement ? (1.0 - w) : w;
+
+        if(u <= cumsum)
+            return covs.at(pos);
+    }
+
+    return covs.at(covs.size() - 1);
+}
+
+PosInt
+ProposalWeights::drawBirthCov(const DenseIndexSet& freeCovs,
+                              RngStream& rng) const
+{
+    return frozen ? drawWeighted(freeCovs, inclusionWeights, false, rng) : discreteUniform(freeCovs, rng);
+}
+
+PosInt
+ProposalWeights::drawDeathCov(const DenseIndexSet& presentCovs,
+                              RngStream& rng) const
+{
+    return frozen ? drawWeighted(presentCovs, inclusionWeights, true, rng) : discreteUniform(presentCovs, rng);
+}
+
+Int
+ProposalWeights::drawPower(PosInt covInd,
+                           RngStream& rng) const
+{
+    const Int card = fpcards[covInd - 1];
+
+    if(! frozen)
+        return uniformRank(card, rng); // the same draw as discreteUniform(0, card)
+
+    const MyDoubleVector& w = powerWeights[covInd - 1];
+    const double u = rng.unif();
+
+    double cumsum = 0.0;
+    for(Int k = 0; k + 1 < card; ++k)
+    {
+        cumsum += w[k];
+        if(u <= cumsum)
+            return k;
+    }
+
+    return card - 1;
+}
+
+// ***************************************************************************************************//
+
+BatchMeans::BatchMeans(PosLargeInt length) :
+    batchSize(std::max(static_cast<PosLargeInt>(std::floor(std::sqrt(static_cast<double>(length)))),
+                       static_cast<PosLargeInt>(1))),
+    nValues(0),
+    sum(0.0),
+    sumSquares(0.0),
+    batchSum(0.0),
+    nInBatch(0),
+    nBatches(0),
+    batchMeanSum(0.0),
+    batchMeanSumSquares(0.0)
+{
+}
+
+void
+BatchMeans::add(double value)
+{
+    ++nValues;
+    sum += value;
+    sumSquares += value * value;
+
+    batchSum += value;
+    if(++nInBatch == batchSize)
+    {
+        const double batchMean = batchSum / batchSize;
+        ++nBatches;
+        batchMeanSum += batchMean;
+        batchMeanSumSquares += batchMean * batchMean;
+
+        batchSum = 0.0;
+        nInBatch = 0;
+    }
+}
+
+double
+BatchMeans::ess() const
+{
+    if(nBatches < 2)
+        return R_NaReal;
+
+    // variance of the trace, and batch size times the variance of the batch means,
+    // which estimates the asymptotic variance of the mean
+    const double variance = (sumSquares - sum * sum / nValues) / (nValues - 1.0);
+    const double asymptoticVariance = batchSize * (batchMeanSumSquares - batchMeanSum * batchMeanSum / nBatches) /
+            (nBatches - 1.0);
+
+    if(! (asymptoticVariance > 0.0))
+        return R_NaReal;
+
+    return nValues * variance / asymptoticVariance;
+}
+
+void
+BatchMeans::save(CheckpointWriter& checkpoint) const
+{
+    checkpoint.write(batchSize);
+    checkpoint.write(nValues);
+    checkpoint.write(sum);
+    checkpoint.write(sumSquares);
+    checkpoint.write(batchSum);
+    checkpoint.write(nInBatch);
+    checkpoint.write(nBatches);
+    checkpoint.write(batchMeanSum);
+    checkpoint.write(batchMeanSumSquares);
+}
+
+void
+BatchMeans::restore(CheckpointReader& checkpoint)
+{
+    checkpoint.read(batchSize);
+    checkpoint.read(nValues);
+    checkpoint.read(sum);
+    checkpoint.read(sumSquares);
+    checkpoint.read(batchSum);
+    checkpoint.read(nInBatch);
+    checkpoint.read(nBatches);
+    checkpoint.read(batchMeanSum);
+    checkpoint.read(batchMeanSumSquares);
+}
+
+// ***************************************************************************************************//
+
+ChainDiagnostics::ChainDiagnostics(PosLargeInt length,
+                                   PosLargeInt nAdapt,
+                                   PosInt nReplicas) :
+    nAdapt(nAdapt),
+    start(Clock::now()),
+    startRecording(start),
+    previousSeconds(0.0),
+    previousTotalSeconds(0.0),
+    nProposed(0),
+    nAccepted(0),
+    nRecorded(0),
+    nRecordedAccepted(0),
+    logPosterior(length > nAdapt ? length - nAdapt : 0),
+    dim(length > nAdapt ? length - nAdapt : 0),
+    nSwapsProposed(nReplicas > 1 ? nReplicas - 1 : 0, 0),
+    nSwapsAccepted(nReplicas > 1 ? nReplicas - 1 : 0, 0)
+{
+}
+
+void
+ChainDiagnostics::record(PosLargeInt t,
+                         bool accepted,
+                         double logPost,
+                         double modelDim)
+{
+    ++nProposed;
+    nAccepted += accepted;
+
+    if(t < nAdapt)
+        return;
+
+    if(t == nAdapt)
+        startRecording = Clock::now();
+
+    ++nRecorded;
+    nRecordedAccepted += accepted;
+
+    logPosterior.add(logPost);
+    dim.add(modelDim);
+}
+
+List
+ChainDiagnostics::convert2list() const
+{
+    const double seconds = previousSeconds + secondsSince(startRecording);
+    const double totalSeconds = previousTotalSeconds + secondsSince(start);
+
+    NumericVector ess = NumericVector::create(_["logPosterior"] = logPosterior.ess(),
+                                              _["dim"] = dim.ess());
+    NumericVector essPerHour = ess * (3600.0 / seconds);
+
+    NumericVector swapAcceptanceRates(nSwapsProposed.size());
+    for(PosInt i = 0; i != nSwapsProposed.size(); ++i)
+    {
+        swapAcceptanceRates[i] = (nSwapsProposed[i] > 0) ? double(nSwapsAccepted[i]) / nSwapsProposed[i] : R_NaReal;
+    }
+
+    return List::create(_["adaptationLength"] = static_cast<double>(nAdapt),
+                        _["acceptanceRate"] = (nProposed > 0) ? double(nAccepted) / nProposed : R_NaReal,
+                        _["acceptanceRateAfterAdaptation"] =
+                                (nRecorded > 0) ? double(nRecordedAccepted) / nRecorded : R_NaReal,
+                        _["ess"] = ess,
+                        _["seconds"] = seconds,
+                        _["totalSeconds"] = totalSeconds,
+                        _["essPerHour"] = essPerHour,
+                        _["swapAcceptanceRates"] = swapAcceptanceRates);
+}
+
+void
+ChainDiagnostics::save(CheckpointWriter& checkpoint) const
+{
+    // before the recording started, its clock is not running yet
+    checkpoint.write((nRecorded > 0) ? previousSeconds + secondsSince(startRecording) : 0.0);
+    checkpoint.write(previousTotalSeconds + secondsSince(start));
+
+    checkpoint.write(nProposed);
+    checkpoint.write(nAccepted);
+    checkpoint.write(nRecorded);
+    checkpoint.write(nRecordedAccepted);
+
+    logPosterior.save(checkpoint);
+    dim.save(checkpoint);
+
+    checkpoint.write(nSwapsProposed);
+    checkpoint.write(nSwapsAccepted);
+}
+
+void
+ChainDiagnostics::restore(CheckpointReader& checkpoint)
+{
+    checkpoint.read(previousSeconds);
+    checkpoint.read(previousTotalSeconds);
+    start = startRecording = Clock::now();
+
+    checkpoint.read(nProposed);
+    checkpoint.read(nAccepted);
+    checkpoint.read(nRecorded);
+    checkpoint.read(nRecordedAccepted);
+
+    logPosterior.restore(checkpoint);
+    dim.restore(checkpoint);
+
+    checkpoint.read(nSwapsProposed);
+    checkpoint.read(nSwapsAccepted);
+}
+
+// ***************************************************************************************************//
+
+AnytimeStop::AnytimeStop(double maxSeconds,
+                         double maxEvaluations,
+                         double epsilon,
+                         PosLargeInt window,
+                         PosInt nGroups) :
+    maxSeconds(maxSeconds),
+    maxEvaluations(maxEvaluations),
+    epsilon(epsilon),
+    window(std::max(window, static_cast<PosLargeInt>(1))),
+    start(Clock::now()),
+    nRecorded(0),
+    counts(nGroups, 0),
+    lastEstimates(),
+    reason("chainlength")
+{
+}
+
+bool
+AnytimeStop::stop(const std::vector<bool>& included,
+                  PosLargeInt nEvaluations)
+{
+    if(checksConvergence())
+    {
+        for(PosInt i = 0; i != counts.size(); ++i)
+        {
+            counts[i] += included[i];
+        }
+
+        // compare the estimates at the end of each window with those of the last one
+        if(++nRecorded % window == 0)
+        {
+            const bool first = lastEstimates.empty();
+            lastEstimates.resize(counts.size());
+
+            double maxChange = 0.0;
+            for(PosInt i = 0; i != counts.size(); ++i)
+            {
+                const double estimate = static_cast<double>(counts[i]) / nRecorded;
+                maxChange = std::max(maxChange, std::fabs(estimate - lastEstimates[i]));
+                lastEstimates[i] = estimate;
+            }
+
+            if((! first) && (maxChange < epsilon))
+            {
+                reason = "convergence";
+                return true;
+            }
+        }
+    }
+
+    if(nEvaluations >= maxEvaluations)
+    {
+        reason = "evaluations";
+        return true;
+    }
+
+    if((maxSeconds < R_PosInf) &&
+       (std::chrono::duration<double>(Clock::now() - start).count() >= maxSeconds))
+    {
+        reason = "time";
+        return true;
+    }
+
+    return false;
+}
+
+// ***************************************************************************************************//
+
+// End of modelProposal.cpp
@@ -0,0 +1,213 @@
+/*
+ * modelStore.cpp
+ */
+
+#include <modelStore.h>
+#include <checkpoint.h>
+#include <functionWraps.h>
+#include <fstream>
+
+using namespace Rcpp;
+
+// ***************************************************************************************************//
+
+// the 64 bit FNV-1a hash of the bytes, starting from the offset basis
+static unsigned long long
+fnv1a(const Rbyte* bytes,
+      R_xlen_t n,
+      unsigned long long offsetBasis)
+{
+    unsigned long long hash = offsetBasis;
+    for(R_xlen_t i = 0; i != n; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// the key from the fingerprint: two hashes with different offset bases
+static ModelStoreKey
+computeKey(const RawVector& fingerprint)
+{
+    return ModelStoreKey(fnv1a(fingerprint.begin(), fingerprint.size(), 14695981039346656037ULL),
+                         fnv1a(fingerprint.begin(), fingerprint.size(), 7809847782465536322ULL));
+}
+
+// ***************************************************************************************************//
+
+ModelStore::ModelStore(const std::string& fileName,
+                       const RawVector& fingerprint) :
+    fileName(fileName),
+    key(computeKey(fingerprint)),
+    records(),
+    added(),
+    rewrite(false),
+    nLoaded(0),
+    nFound(0),
+    nAdded(0)
+{
+    // a new store starts empty
+    if(! active() || ! std::ifstream(fileName.c_str()))
+        return;
+
+    CheckpointReader file(fileName, MyDoubleVector(), "model store");
+
+    try
+    {
+        while(! file.atEnd())
+        {
+            // the records of a block are only taken when the block is complete
+            PosLargeInt nRecords;
+            file.read(nRecords);
+
+            std::vector<std::pair<MapType::key_type, MapType::mapped_type> > block;
+
+            for(; nRecords != 0; --nRecords)
+            {
+                ModelStoreKey recordKey;
+                file.read(recordKey);
+
+                ModelPar par(0);
+                par.restore(file);
+
+                double logMargLik, zMode, zVar, laplaceApprox, residualDeviance;
+                MyDoubleVector args, vals;
+
+                file.read(logMargLik);
+                file.read(args);
+                file.read(vals);
+                file.read(zMode);
+                file.read(zVar);
+                file.read(laplaceApprox);
+                file.read(residualDeviance);
+
+                Cache cache;
+                for(PosInt i = 0; i < args.size() && i < vals.size(); ++i)
+                {
+                    cache.save(args[i], vals[i]);
+                }
+
+                block.push_back(std::make_pair(std::make_pair(recordKey, par),
+                                               GlmModelInfo(logMargLik, R_NaReal, cache, zMode, zVar,
+                                                            laplaceApprox, residualDeviance)));
+            }
+
+            for(PosLargeInt i = 0; i != block.size(); ++i)
+            {
+                if(records.insert(block[i]).second)
+                    nLoaded += (block[i].first.first == key);
+            }
+        }
+    }
+    catch(std::exception&)
+    {
+        // an incomplete last block: keep the complete blocks, and rewrite the file at the next flush
+        Rf_warning("model store file %s ends with an incomplete block, which is dropped",
+                   fileName.c_str());
+        rewrite = true;
+    }
+}
+
+// ***************************************************************************************************//
+
+const GlmModelInfo*
+ModelStore::find(const ModelPar& par)
+{
+    if(! active())
+        return NULL;
+
+    MapType::const_iterator r = records.find(std::make_pair(key, par));
+    if(r == records.end())
+        return NULL;
+
+    ++nFound;
+    return &(r->second);
+}
+
+void
+ModelStore::add(const ModelPar& par,
+                const GlmModelInfo& info)
+{
+    if(! active())
+        return;
+
+    std::pair<MapType::iterator, bool> inserted =
+            records.insert(MapType::value_type(std::make_pair(key, par), info));
+    if(inserted.second)
+    {
+        added.push_back(inserted.first);
+        ++nAdded;
+    }
+}
+
+// ***************************************************************************************************//
+
+void
+ModelStore::writeRecord(CheckpointWriter& file,
+                        const MapType::value_type& r)
+{
+    file.write(r.first.first);
+    r.first.second.save(file);
+
+    const GlmModelInfo& info = r.second;
+    file.write(info.logMargLik);
+    file.write(info.negLogUnnormZDensities.getArgs());
+    file.write(info.negLogUnnormZDensities.getVals());
+    file.write(info.zMode);
+    file.write(info.zVar);
+    file.write(info.laplaceApprox);
+    file.write(info.residualDeviance);
+}
+
+void
+ModelStore::flush()
+{
+    if(! active() || (added.empty() && ! rewrite))
+        return;
+
+    if(! rewrite && std::ifstream(fileName.c_str()))
+    {
+        // append a block with the new records to the existing file
+        CheckpointWriter file(fileName, MyDoubleVector(), "model store", true);
+
+        file.write(static_cast<PosLargeInt>(added.size()));
+        for(PosLargeInt i = 0; i != added.size(); ++i)
+        {
+            writeRecord(file, *added[i]);
+        }
+
+        file.commit();
+    }
+    else
+    {
+        // (re)write the whole store as one block
+        CheckpointWriter file(fileName, MyDoubleVector(), "model store");
+
+        file.write(static_cast<PosLargeInt>(records.size()));
+        for(MapType::const_iterator r = records.begin(); r != records.end(); ++r)
+        {
+            writeRecord(file, *r);
+        }
+
+        file.commit();
+    }
+
+    added.clear();
+    rewrite = false;
+}
+
+// ***************************************************************************************************//
+
+List
+ModelStore::convert2list() const
+{
+    return List::create(_["file"] = fileName,
+                        _["nLoaded"] = static_cast<double>(nLoaded),
+                        _["nFound"] = static_cast<double>(nFound),
+                        _["nAdded"] = static_cast<double>(nAdded));
+}
+
+// ***************************************************************************************************//
+
+// End of modelStore.cpp
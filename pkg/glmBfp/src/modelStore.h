@@ -0,0 +1,89 @@
+/*
+ * modelStore.h
+ */
+
+#ifndef MODELSTORE_H_
+#define MODELSTORE_H_
+
+#include <types.h>
+#include <rcppExport.h>
+#include <dataStructure.h>
+#include <checkpoint.h>
+#include <string>
+#include <map>
+#include <vector>
+#include <utility>
+
+// ***************************************************************************************************//
+
+// the key of a model search in the model store: a 128 bit hash of the data, the prior
+// and the family, computed from the serialized R objects which determine the marginal likelihoods
+typedef std::pair<unsigned long long, unsigned long long> ModelStoreKey;
+
+// Persistent store of the computed models, which is reused across runs.
+// For each model it holds the log marginal likelihood and the byproducts of its computation
+// (z mode and variance, Laplace approximation, residual deviance and the cached z density
+// evaluations), but not the log prior, which is cheap and depends on the model prior only.
+// The records of all model searches sharing the file are kept, each under its key,
+// and looked up for the key of the current search.
+// The file uses the checkpoint file format and consists of blocks of records: flush() appends
+// one block with the models added since the last flush, so the file grows with the new models
+// only. It is read once at construction, decoding all records into the map, so it is not mapped
+// into memory. A last block which a killed session has left incomplete is dropped, and then the
+// next flush rewrites the whole store. Concurrent runs must not share a store file.
+class ModelStore
+{
+public:
+    // empty fileName gives an inactive store which does nothing.
+    // The fingerprint is the serialized R information from which the key is computed.
+    ModelStore(const std::string& fileName,
+               const Rcpp::RawVector& fingerprint);
+
+    bool
+    active() const
+    {
+        return ! fileName.empty();
+    }
+
+    // look up the model in the store, and return NULL if it is not there
+    const GlmModelInfo*
+    find(const ModelPar& par);
+
+    // add a newly computed model
+    void
+    add(const ModelPar& par,
+        const GlmModelInfo& info);
+
+    // append the models added since the last flush to the store file
+    void
+    flush();
+
+    // counts of loaded, found and added models, as R list
+    Rcpp::List
+    convert2list() const;
+
+private:
+    typedef std::map<std::pair<ModelStoreKey, ModelPar>, GlmModelInfo> MapType;
+
+    // write one record
+    static void
+    writeRecord(CheckpointWriter& file,
+                const MapType::value_type& r);
+
+    const std::string fileName;
+    const ModelStoreKey key;
+
+    MapType records;
+
+    // the records added since the last flush
+    std::vector<MapType::const_iterator> added;
+
+    // must the whole file be rewritten at the next flush?
+    bool rewrite;
+
+    PosLargeInt nLoaded, nFound, nAdded;
+};
+
+// ***************************************************************************************************//
+
+#endif /* MODELSTORE_H_ */
@@ -16,7 +16,8 @@ using namespace Rcpp;
 // just an R interface to the brent optimization routine, for regression testing purposes.
 // [[Rcpp::export]]
 SEXP
-cpp_optimize(SEXP R_function,  SEXP R_minx, SEXP R_maxx, SEXP R_precision)
+cpp_optimize(SEXP R_function,  SEXP R_minx, SEXP R_maxx, SEXP R_precision,
+             SEXP R_accurate)
 {
     // extract function
     // R_interface = CDR(R_interface);
@@ -46,13 +47,23 @@ cpp_optimize(SEXP R_function,  SEXP R_minx, SEXP R_maxx, SEXP R_precision)
     double xMin = brent.minimize();
 
     // now the inverse Hessian at the minimum
-    AccurateNumericInvHessian<CachedFunction<RFunction> > funInvHess(cachedFun);
+    AdaptiveNumericInvHessian<CachedFunction<RFunction> > funInvHess(cachedFun);
     double invHessMin = funInvHess(xMin);
 
     // pack results into R list
-    return List::create(_["par"] = xMin,
-                        _["inv.hessian"] = invHessMin,
-                        _["evaluations"] = cachedFun.getCache().convert2list());
+    List ret = List::create(_["par"] = xMin,
+                            _["inv.hessian"] = invHessMin,
+                            _["evaluations"] = cachedFun.getCache().convert2list());
+
+    // only if requested: the classic Ridders estimate for comparison, which does
+    // not touch the cache but needs many more function evaluations
+    if(Rf_asLogical(R_accurate))
+    {
+        AccurateNumericInvHessian<RFunction> accurateInvHess(fun);
+        ret["accurate.inv.hessian"] = accurateInvHess(xMin);
+    }
+
+    return ret;
 }
 
 // ***************************************************************************************************//
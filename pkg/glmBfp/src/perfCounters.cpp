@@ -0,0 +1,126 @@
+/*
+ * perfCounters.cpp
+ */
+
+#include <perfCounters.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+
+using namespace Rcpp;
+
+// ***************************************************************************************************//
+
+PerfCounters perfCounters;
+
+static const char* counterNames[PerfCounters::nCounters] = {
+        "zDensityCalls",
+        "iwlsIterations",
+        "choleskyFailures",
+        "zCacheHits",
+        "zCacheMisses",
+        "modelCacheHits",
+        "modelCacheMisses",
+        "modelCacheEvictions",
+        "coxFits"
+};
+
+static const char* phaseNames[PerfCounters::nPhases] = {
+        "design",
+        "iwls",
+        "coxfit",
+        "optimization",
+        "quadrature",
+        "margLik",
+        "sampling"
+};
+
+// ***************************************************************************************************//
+
+void
+PerfCounters::reset()
+{
+    int nThreads = 1;
+#ifdef _OPENMP
+    nThreads = std::max(omp_get_max_threads(), omp_get_num_procs());
+#endif
+
+    Slot empty;
+    std::fill(empty.counts, empty.counts + nCounters, 0);
+    std::fill(empty.seconds, empty.seconds + nPhases, 0.0);
+
+    slots.assign(nThreads, empty);
+}
+
+// ***************************************************************************************************//
+
+PerfCounters::Slot&
+PerfCounters::slot()
+{
+    PosInt thread = 0;
+#ifdef _OPENMP
+    // the thread number in the outermost active team: inner teams, which are usually
+    // inactive (serialized) and then all have thread number 0, count into the slot of
+    // the outer thread which runs them
+    const int level = omp_get_level();
+    for(int l = 1; l <= level; ++l)
+    {
+        if(omp_get_team_size(l) > 1)
+        {
+            thread = omp_get_ancestor_thread_num(l) % slots.size();
+            break;
+        }
+    }
+#endif
+    return slots[thread];
+}
+
+// ***************************************************************************************************//
+
+List
+PerfCounters::convert2list() const
+{
+    const PosInt nThreads = slots.size();
+
+    NumericMatrix threadCounts(nThreads, nCounters);
+    NumericMatrix threadSeconds(nThreads, nPhases);
+    NumericVector counts(nCounters);
+    NumericVector seconds(nPhases);
+    CharacterVector countNames(nCounters);
+    CharacterVector secondNames(nPhases);
+
+    for(PosInt c = 0; c < nCounters; ++c)
+    {
+        countNames[c] = counterNames[c];
+        for(PosInt t = 0; t < nThreads; ++t)
+        {
+            threadCounts(t, c) = slots[t].counts[c];
+            counts[c] += slots[t].counts[c];
+        }
+    }
+
+    for(PosInt p = 0; p < nPhases; ++p)
+    {
+        secondNames[p] = phaseNames[p];
+        for(PosInt t = 0; t < nThreads; ++t)
+        {
+            threadSeconds(t, p) = slots[t].seconds[p];
+            seconds[p] += slots[t].seconds[p];
+        }
+    }
+
+    counts.names() = countNames;
+    seconds.names() = secondNames;
+    colnames(threadCounts) = countNames;
+    colnames(threadSeconds) = secondNames;
+
+    return List::create(_["counts"] = counts,
+                        _["seconds"] = seconds,
+                        _["threadCounts"] = threadCounts,
+                        _["threadSeconds"] = threadSeconds);
+}
+
+// ***************************************************************************************************//
@@ -0,0 +1,138 @@
+/*
+ * perfCounters.h
+ */
+
+#ifndef PERFCOUNTERS_H_
+#define PERFCOUNTERS_H_
+
+#include <types.h>
+#include <rcppExport.h>
+
+#include <chrono>
+#include <vector>
+
+// ***************************************************************************************************//
+
+// low-overhead performance counters and phase timers of the model search and the sampler.
+// Each thread of the outermost active OpenMP team counts into its own slot, so no
+// synchronization is needed as long as the inner teams are inactive (nested parallelism
+// is not enabled by the package).
+// The engines reset the global object perfCounters at the start, and return
+// its contents as an attribute of the result.
+class PerfCounters
+{
+public:
+    enum Counter
+    {
+        zDensityCalls,       // calls of NegLogUnnormZDens
+        iwlsIterations,      // IWLS iterations
+        choleskyFailures,    // failed Cholesky factorizations
+        zCacheHits,          // z density values found in the cache of CachedFunction
+        zCacheMisses,        // and computed
+        modelCacheHits,      // models found in the model cache of the sampler
+        modelCacheMisses,    // and not found
+        modelCacheEvictions, // models removed from the full model cache for better ones
+        coxFits,             // Cox model fits
+        nCounters
+    };
+
+    // the phases can be nested, e.g. the design matrices are constructed within the
+    // marginal likelihood phase, so the times do not add up to the total time.
+    enum Phase
+    {
+        designPhase,         // design matrix construction
+        iwlsPhase,           // IWLS iterations
+        coxfitPhase,         // Cox model fits
+        optimizationPhase,   // BFGS / Brent optimization of the z density and its variance
+        quadraturePhase,     // Gauss-Hermite quadrature nodes
+        margLikPhase,        // whole log marginal likelihood approximations
+        samplingPhase,       // the MCMC / MC sampling of the parameters in sampleGlm
+        nPhases
+    };
+
+    PerfCounters()
+    {
+        reset();
+    }
+
+    // clear all counters and timers, with one slot for each possible thread
+    void
+    reset();
+
+    void
+    increment(Counter counter, PosLargeInt n = 1)
+    {
+        slot().counts[counter] += n;
+    }
+
+    void
+    addSeconds(Phase phase, double seconds)
+    {
+        slot().seconds[phase] += seconds;
+    }
+
+    // the totals over all threads, and the counts and seconds per thread
+    Rcpp::List
+    convert2list() const;
+
+private:
+    // padded to separate cache lines of the threads
+    struct Slot
+    {
+        PosLargeInt counts[nCounters];
+        double seconds[nPhases];
+        char padding[64];
+    };
+
+    Slot&
+    slot();
+
+    std::vector<Slot> slots;
+};
+
+// the counters of the current engine call
+extern PerfCounters perfCounters;
+
+// ***************************************************************************************************//
+
+// adds the time of its lifetime, or until stop() is called, to a phase
+class PhaseTimer
+{
+public:
+    explicit
+    PhaseTimer(PerfCounters::Phase phase) :
+        phase(phase),
+        start(Clock::now()),
+        running(true)
+        {}
+
+    ~PhaseTimer()
+    {
+        stop();
+    }
+
+    void
+    stop()
+    {
+        if(running)
+        {
+            perfCounters.addSeconds(phase, std::chrono::duration<double>(Clock::now() - start).count());
+            running = false;
+        }
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    // not copyable
+    PhaseTimer(const PhaseTimer&);
+    PhaseTimer& operator=(const PhaseTimer&);
+
+    const PerfCounters::Phase phase;
+    const Clock::time_point start;
+    bool running;
+};
+
+// ***************************************************************************************************//
+
+#endif /* PERFCOUNTERS_H_ */
@@ -18,7 +18,12 @@
 #include <optimize.h>
 #include <fpUcHandling.h>
 #include <linalgInterface.h>
+#include <memoryUsage.h>
+#include <rngStreams.h>
+#include <perfCounters.h>
 //#include <cassert>
+#include <string>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -102,6 +107,23 @@ struct Fitter
 
 
 
+// ***************************************************************************************************//
+
+// log of the normal proposal density N(proposalInfo.coefs, (qFactor * t(qFactor))^(-1)) at coefs.
+// This is only the coefficients part, so it does not call R and can be used in threads.
+double
+logNormalProposalDens(const AVector& coefs,
+                      const IwlsResults& proposalInfo)
+{
+    // Be careful: qFactor is in fact lower-triangular, so a simple multiplication would fail!
+    // use instead directly a BLAS routine for this multiplication.
+    AVector tmp = coefs - proposalInfo.coefs;
+    trmv(false, true, proposalInfo.qFactor, tmp);
+
+    return 0.5 * (proposalInfo.logPrecisionDeterminant - arma::dot(tmp, tmp)) -
+           M_LN_SQRT_2PI * proposalInfo.qFactor.n_rows;
+}
+
 // ***************************************************************************************************//
 
 
@@ -132,13 +154,7 @@ public:
     double
     computeLogProposalDens() const
     {
-        // Be careful: qFactor is in fact lower-triangular, so a simple multiplication would fail!
-        // use instead directly a BLAS routine for this multiplication.
-        AVector tmp = sample.coefs - proposalInfo.coefs;
-        trmv(false, true, proposalInfo.qFactor, tmp);
-
-        return 0.5 * (proposalInfo.logPrecisionDeterminant - arma::dot(tmp, tmp)) -
-               M_LN_SQRT_2PI * proposalInfo.qFactor.n_rows +
+        return logNormalProposalDens(sample.coefs, proposalInfo) +
                marginalz.logDens(sample.z);
     }
 
@@ -189,6 +205,16 @@ struct Samples
         zSamples.push_back(sample.z);
     }
 
+    // save all samples at once: takes over the memory of the coefs matrix
+    // (nCoefs x nSamples), which is left empty
+    void
+    storeParameterBlock(AMatrix& coefs, const NumericVector& z)
+    {
+        coefsSamples.swap(coefs);
+        nSaved = coefsSamples.n_cols;
+        zSamples.assign(z.begin(), z.end());
+    }
+
     // save terms for marginal likelihood estimate
     void
     storeMargLikTerms(double num, double denom)
@@ -197,6 +223,27 @@ struct Samples
         denominator.push_back(denom);
     }
 
+    // save the terms for all samples at once
+    void
+    storeMargLikTermsBlock(const MyDoubleVector& num, const MyDoubleVector& denom)
+    {
+        numerator = num;
+        denominator = denom;
+    }
+
+    // the saved coefficients (nCoefs x nSaved) and z samples
+    const AMatrix&
+    getCoefs() const
+    {
+        return coefsSamples;
+    }
+
+    const MyDoubleVector&
+    getZ() const
+    {
+        return zSamples;
+    }
+
     // output everything to an R list
     List
     convert2list() const;
@@ -233,20 +280,23 @@ Samples::convert2list() const
 
 // get a vector with normal variates from N(mean, sd^2)
 AVector
-drawNormalVariates(PosInt n, double mean, double sd)
+drawNormalVariates(PosInt n, double mean, double sd, RngStream& rng)
 {
     AVector ret(n);
 
-    // use R's random number generator
-    GetRNGstate();
+    // R's random number generator must be synchronized here,
+    // because the z generator function also uses it (via R)
+    if(rng.isLegacy())
+        GetRNGstate();
 
     for (PosInt i = 0; i < n; ++i)
     {
-        ret(i) = Rf_rnorm(mean, sd);
+        ret(i) = mean + sd * rng.normal();
     }
 
     // no RNs required anymore
-    PutRNGstate();
+    if(rng.isLegacy())
+        PutRNGstate();
 
     return ret;
 }
@@ -254,12 +304,14 @@ drawNormalVariates(PosInt n, double mean, double sd)
 // draw a single random normal vector from N(mean, (precisionCholeskyFactor * t(precisionCholeskyFactor))^(-1))
 AVector
 drawNormalVector(const AVector& mean,
-                 const AMatrix& precisionCholeskyFactor)
+                 const AMatrix& precisionCholeskyFactor,
+                 RngStream& rng)
 {
     // get vector from N(0, I)
     AVector w = drawNormalVariates(mean.n_rows, // as many normal variates as required by the dimension.
                                    0.0,
-                                   1.0);
+                                   1.0,
+                                   rng);
 
     // then solve L' * ret = w, and overwrite w with the result:
     trs(false,
@@ -275,18 +327,245 @@ drawNormalVector(const AVector& mean,
 // draw a single uniform random variable:
 // be careful with the seed because the z generator function also uses it (via R)
 double
-unif()
+unif(RngStream& rng)
 {
-    GetRNGstate();
+    if(rng.isLegacy())
+        GetRNGstate();
 
-    double ret = unif_rand();
+    double ret = rng.unif();
 
-    PutRNGstate();
+    if(rng.isLegacy())
+        PutRNGstate();
 
     return ret;
 }
 
 
+// ***************************************************************************************************//
+
+// number of samples which share one random number stream in the TBF block sampler.
+// This is fixed, so that the samples do not depend on the number of threads.
+static const PosInt tbfBlockSize = 1024;
+
+// draw all TBF coefficients samples at once, given the z samples.
+// The mean and the Cholesky factor of the precision come from the proposal info,
+// coefficients from startCoef onwards are shrunk with the factor t = g / (g + 1).
+// The N(0, I) variates are generated in parallel from independent substreams of rng,
+// and then a single triangular solve handles all samples together.
+AMatrix
+drawTbfCoefsBlock(const IwlsResults& proposalInfo,
+                  const NumericVector& zSamples,
+                  PosInt startCoef,
+                  const RngStream& rng)
+{
+    const PosInt nCoefs = proposalInfo.coefs.n_elem;
+    const PosInt nSamples = zSamples.size();
+    const int nBlocks = (nSamples + tbfBlockSize - 1) / tbfBlockSize;
+
+    AMatrix ret(nCoefs, nSamples);
+    double* retPtr = ret.memptr();
+
+#pragma omp parallel for schedule(static)
+    for(int block = 0; block < nBlocks; ++block)
+    {
+        RngStream blockRng = rng.split(block);
+
+        const PosInt start = block * tbfBlockSize * nCoefs;
+        const PosInt stop = std::min((block + 1) * tbfBlockSize, nSamples) * nCoefs;
+
+        for(PosInt i = start; i < stop; ++i)
+        {
+            retPtr[i] = blockRng.normal();
+        }
+    }
+
+    // then solve L' * ret = w for all columns w in one go, overwriting ret:
+    trs(false,
+        true,
+        proposalInfo.qFactor,
+        ret);
+
+    // finally scale and shift each sample according to its z
+    const double* mean = proposalInfo.coefs.memptr();
+    const double* z = zSamples.begin();
+
+#pragma omp parallel for schedule(static)
+    for(int j = 0; j < static_cast<int>(nSamples); ++j)
+    {
+        const double g = exp(z[j]);
+        const double shrinkFactor = std::isinf(g) ? 1 : g / (g + 1.0);
+        const double sdFactor = sqrt(shrinkFactor);
+
+        double* col = retPtr + static_cast<PosInt>(j) * nCoefs;
+
+        for(PosInt k = 0; k < startCoef; ++k)
+        {
+            col[k] += mean[k];
+        }
+        for(PosInt k = startCoef; k < nCoefs; ++k)
+        {
+            col[k] = col[k] * sdFactor + mean[k] * shrinkFactor;
+        }
+    }
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+// number of samples per chunk in the marginal likelihood post-pass: the posterior densities
+// of the proposals in one chunk are computed together, with one matrix product.
+// This is fixed, so that the results do not depend on the number of threads.
+static const PosInt margLikChunkSize = 256;
+
+// compute the Chib-Jeliazkov numerator and denominator terms for all stored samples
+// after the chain has finished, in parallel over chunks of samples.
+// Each thread works with its own copy of the IWLS object. The marginal z log densities
+// have been evaluated (in R) beforehand, and each chunk draws from its own substream of rng.
+void
+computeMargLikTermsPostPass(const Iwls& iwlsPrototype,
+                            const Mcmc& highDensityPoint,
+                            const Samples& samples,
+                            const MyDoubleVector& logUnPosteriors,
+                            const NumericVector& logMarginalZ,
+                            const NumericVector& denominatorZ,
+                            const NumericVector& logMarginalDenominatorZ,
+                            double logMarginalHighDensityZ,
+                            const RngStream& rng,
+                            bool parallel,
+                            MyDoubleVector& numeratorTerms,
+                            MyDoubleVector& denominatorTerms)
+{
+    const AMatrix& coefsSamples = samples.getCoefs();
+    const MyDoubleVector& zSamples = samples.getZ();
+
+    const PosInt nSamples = zSamples.size();
+    const int nChunks = (nSamples + margLikChunkSize - 1) / margLikChunkSize;
+
+    numeratorTerms.resize(nSamples);
+    denominatorTerms.resize(nSamples);
+
+    const double highDensityG = exp(highDensityPoint.sample.z);
+    const AVector& highDensityCoefs = highDensityPoint.sample.coefs;
+    const AVector& highDensityLinPred = highDensityPoint.proposalInfo.linPred;
+
+    int nThreads = 1;
+#ifdef _OPENMP
+    if(parallel)
+    {
+        nThreads = std::max(1, std::min(omp_get_max_threads(), nChunks));
+    }
+#endif
+
+    // errors cannot leave the threads, so they are collected here
+    std::vector<std::string> errors(nThreads);
+
+#pragma omp parallel num_threads(nThreads)
+    {
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        Iwls iwls(iwlsPrototype);
+
+#pragma omp for schedule(dynamic)
+        for(int chunk = 0; chunk < nChunks; ++chunk)
+        {
+            if(! errors[thread].empty())
+            {
+                continue;
+            }
+
+            try
+            {
+                RngStream chunkRng = rng.split(chunk);
+
+                const PosInt start = chunk * margLikChunkSize;
+                const PosInt stop = std::min(start + margLikChunkSize, nSamples);
+                const PosInt size = stop - start;
+
+                AMatrix proposalCoefs(iwls.nCoefs, size);
+                AVector proposalZ(size);
+                AVector logProposalRatios(size);
+
+                for(PosInt k = 0; k < size; ++k)
+                {
+                    const PosInt i = start + k;
+
+                    // next term for the denominator:
+                    // draw from the high density point proposal distribution
+                    iwls.startWithNewLinPred(1,
+                                             exp(denominatorZ[i]),
+                                             highDensityLinPred);
+                    const IwlsResults proposalInfo = iwls.getResults();
+
+                    proposalZ(k) = denominatorZ[i];
+                    proposalCoefs.col(k) = drawNormalVector(proposalInfo.coefs,
+                                                            proposalInfo.qFactor,
+                                                            chunkRng);
+
+                    const double logProposalDens = logNormalProposalDens(proposalCoefs.col(k), proposalInfo) +
+                                                   logMarginalDenominatorZ[i];
+
+                    // the reverse proposal density of the high density point
+                    iwls.startWithNewCoefs(1,
+                                           highDensityG,
+                                           proposalCoefs.col(k));
+                    const double revLogProposalDens = logNormalProposalDens(highDensityCoefs, iwls.getResults()) +
+                                                      logMarginalHighDensityZ;
+
+                    logProposalRatios(k) = revLogProposalDens - logProposalDens;
+
+                    // next term for the numerator:
+                    // the proposal density of the stored sample starting from the high density point
+                    const AVector coefs = coefsSamples.col(i);
+
+                    iwls.startWithNewLinPred(1,
+                                             exp(zSamples[i]),
+                                             highDensityLinPred);
+                    const double numLogProposalDens = logNormalProposalDens(coefs, iwls.getResults()) +
+                                                      logMarginalZ[i];
+
+                    // and the reverse proposal density of the high density point
+                    iwls.startWithNewCoefs(1,
+                                           highDensityG,
+                                           coefs);
+                    const double revNumLogProposalDens = logNormalProposalDens(highDensityCoefs, iwls.getResults()) +
+                                                         logMarginalHighDensityZ;
+
+                    numeratorTerms[i] = exp(fmin(revNumLogProposalDens,
+                                                 highDensityPoint.logUnPosterior - logUnPosteriors[i] +
+                                                 numLogProposalDens));
+                }
+
+                // the posterior densities of all proposals in this chunk
+                const AVector proposalLogUnPosteriors = iwls.computeLogUnPosteriorDens(proposalCoefs,
+                                                                                       proposalZ);
+
+                for(PosInt k = 0; k < size; ++k)
+                {
+                    denominatorTerms[start + k] = exp(fmin(0.0,
+                                                           proposalLogUnPosteriors(k) - highDensityPoint.logUnPosterior +
+                                                           logProposalRatios(k)));
+                }
+            }
+            catch (std::exception& error)
+            {
+                errors[thread] = error.what();
+            }
+        }
+    }
+
+    for(int thread = 0; thread < nThreads; ++thread)
+    {
+        if(! errors[thread].empty())
+        {
+            Rcpp::stop(errors[thread]);
+        }
+    }
+}
+
+
 // ***************************************************************************************************//
 
 
@@ -348,16 +627,17 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
     // ----------------------------------------------------------------------------------
 
     // data:
+    // (the Armadillo objects are views of the R memory, nothing is copied)
     const NumericMatrix n_x = rcpp_data["x"];
-    const AMatrix x(n_x.begin(), n_x.nrow(),
-                   n_x.ncol());
+    const AMatrix x = shareMatrix(n_x.begin(), n_x.nrow(),
+                                  n_x.ncol());
 
     const NumericMatrix n_xCentered = rcpp_data["xCentered"];
-    const AMatrix xCentered(n_xCentered.begin(), n_xCentered.nrow(),
-                           n_xCentered.ncol());
+    const AMatrix xCentered = shareMatrix(n_xCentered.begin(), n_xCentered.nrow(),
+                                          n_xCentered.ncol());
 
     const NumericVector n_y = rcpp_data["y"];
-    const AVector y(n_y.begin(), n_y.size());
+    const AVector y = shareVector(n_y.begin(), n_y.size());
 
     const IntVector censInd = as<IntVector>(rcpp_data["censInd"]);
 
@@ -421,6 +701,8 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
     const bool isNullModel = as<bool>(rcpp_options["isNullModel"]);
     const bool useFixedZ = as<bool>(rcpp_options["useFixedZ"]);
     const double fixedZ = as<double>(rcpp_options["fixedZ"]);
+    const bool legacyRng = as<bool>(rcpp_options["legacyRng"]);
+    const bool margLikPostPass = as<bool>(rcpp_options["margLikPostPass"]);
 #ifdef _OPENMP
     const bool useOpenMP = as<bool>(rcpp_options["useOpenMP"]);
 #endif
@@ -435,6 +717,10 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
 
     const RFunction logMarginalZdens(as<SEXP>(rcpp_marginalz["logDens"]));
     const RFunction marginalZgen(as<SEXP>(rcpp_marginalz["gen"]));
+    // the same generator, but for drawing all z samples in one call
+    Function marginalZgenBlock(as<SEXP>(rcpp_marginalz["gen"]));
+    // and the log density for evaluating a vector of z values
+    Function logMarginalZdensBlock(as<SEXP>(rcpp_marginalz["logDens"]));
 
 
     // ----------------------------------------------------------------------------------
@@ -450,6 +736,15 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
      // totalnumber is set to 0 because we do not care about it.
      const DataValues data(x, xCentered, y, censInd, 0, fixedCols);
 
+     if(verbose)
+     {
+         MemoryReport memory;
+         memory.add(data.design);
+         memory.add(data.centeredDesign);
+         memory.add(data.response);
+         memory.print("cpp_sampleGlm");
+     }
+
      // FP configuration:
      const FpInfo fpInfo(fpcards, fppos, fpmaxs, fpnames, x);
 
@@ -466,7 +761,7 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
          maxUcDim += thisSize;
          ucSizes.push_back(thisSize);
      }
-     const UcInfo ucInfo(ucSizes, maxUcDim, ucIndices, ucColList);
+     const UcInfo ucInfo(ucSizes, maxUcDim, ucIndices, ucColList, xCentered);
 
   
      // fix configuration:  
@@ -515,6 +810,9 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
      const MarginalZ marginalZ(logMarginalZdens,
                                marginalZgen);
 
+     // the random number stream for the coefficients and the acceptance decisions
+     RngStream rng = getRngStream(legacyRng);
+
 
      // use only one thread if we do not want to use openMP.
 #ifdef _OPENMP
@@ -526,6 +824,9 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
      }
 #endif
 
+     // count and time the phases of this sampler from scratch
+     perfCounters.reset();
+
 
      // ----------------------------------------------------------------------------------
      // prepare the sampling
@@ -722,6 +1023,52 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
      // start sampling
      // ----------------------------------------------------------------------------------
 
+     PhaseTimer samplingTimer(PerfCounters::samplingPhase);
+
+     // in the TBF case, the samples are i.i.d., so we can draw them all at once
+     // (unless the sequential draws from R's RNG shall be reproduced)
+     const bool blockSampling = tbf && (! legacyRng);
+
+     // compute the marginal likelihood terms after the chain, in a parallel post-pass?
+     // (Again not if the sequential draws from R's RNG shall be reproduced.)
+     const bool postPass = options.estimateMargLik && (! options.tbf) && margLikPostPass && (! legacyRng);
+
+     // for the post-pass, we save the log unnormalized posterior densities of the stored samples
+     MyDoubleVector storedLogUnPosteriors;
+
+     if(blockSampling)
+     {
+         // echo debug-level message?
+         if(options.debug)
+         {
+             Rprintf("\ncpp_sampleGlm: Starting blockwise MC simulation");
+         }
+
+         // all z samples from the R generator
+         const NumericVector zSamples = marginalZgenBlock(options.nSamples);
+
+         // the null model has only the intercept which is not shrunk.
+         // In the Cox case: no intercept present, so scale everything
+         const PosInt startCoef = options.isNullModel ? nCoefs : (options.doGlm ? 1 : 0);
+
+         AMatrix coefsSamples = drawTbfCoefsBlock(now.proposalInfo,
+                                                  zSamples,
+                                                  startCoef,
+                                                  rng);
+         samples.storeParameterBlock(coefsSamples, zSamples);
+
+         nAccepted = options.nSamples;
+
+         if(options.verbose)
+         {
+             // the progress bar in one go
+             for(int i = 0; i < 100; ++i)
+             {
+                 Rprintf("-");
+             }
+         }
+     }
+
      // echo debug-level message?
      if(options.debug)
      {
@@ -736,8 +1083,8 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
      }
 
 
-     // i_iter starts at 1 !!
-     for(PosInt i_iter = 1; i_iter <= options.iterations; ++i_iter)
+     // i_iter starts at 1 !! (and the loop is skipped after block sampling)
+     for(PosInt i_iter = 1; (! blockSampling) && (i_iter <= options.iterations); ++i_iter)
      {
          // echo debug-level message?
          if(options.debug)
@@ -765,7 +1112,8 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
 
                  // draw the proposal coefs, which is here just the intercept
                  now.sample.coefs = drawNormalVector(now.proposalInfo.coefs,
-                                                     now.proposalInfo.qFactor);
+                                                     now.proposalInfo.qFactor,
+                                                     rng);
 
              }
              else
@@ -774,7 +1122,8 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
                  // get vector from N(0, I)
                  AVector w = drawNormalVariates(now.proposalInfo.coefs.n_elem,
                                                 0.0,
-                                                1.0);
+                                                1.0,
+                                                rng);
 
                  // then solve L' * ret = w, and overwrite w with the result:
                  trs(false,
@@ -820,7 +1169,8 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
 
              // draw the proposal coefs:
              now.sample.coefs = drawNormalVector(now.proposalInfo.coefs,
-                                                 now.proposalInfo.qFactor);
+                                                 now.proposalInfo.qFactor,
+                                                 rng);
 
              // compute the (unnormalized) log posterior of the proposal
              now.logUnPosterior = fitter.iwlsObject->computeLogUnPosteriorDens(now.sample);
@@ -868,7 +1218,7 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
 
              double acceptanceProb = exp(logPosteriorRatio + logProposalRatio);
 
-             if(unif() < acceptanceProb)
+             if(unif(rng) < acceptanceProb)
              {
                  old = now;
 
@@ -898,6 +1248,11 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
              // store the current parameter sample
              samples.storeParameters(now.sample);
 
+             if(postPass)
+             {
+                 storedLogUnPosteriors.push_back(now.logUnPosterior);
+             }
+
              // ----------------------------------------------------------------------------------
              // compute marginal likelihood terms
              // ----------------------------------------------------------------------------------
@@ -906,7 +1261,7 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
              // (Note that the tbf bool is just for safety here,
              // the R function sampleGlm will set estimateMargLik to FALSE
              // when tbf is TRUE.)
-             if(options.estimateMargLik && (! options.tbf))
+             if(options.estimateMargLik && (! options.tbf) && (! postPass))
              {
                  // echo debug-level message?
                  if(options.debug)
@@ -929,7 +1284,8 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
                  denominator.proposalInfo = fitter.iwlsObject->getResults();
 
                  denominator.sample.coefs = drawNormalVector(denominator.proposalInfo.coefs,
-                                                             denominator.proposalInfo.qFactor);
+                                                             denominator.proposalInfo.qFactor,
+                                                             rng);
 
                  // get posterior density of the sample
                  denominator.logUnPosterior = fitter.iwlsObject->computeLogUnPosteriorDens(denominator.sample);
@@ -1030,13 +1386,60 @@ cpp_sampleGlm(      List rcpp_model,List rcpp_data, List rcpp_fpInfos, List rcpp
      }
 
 
+     samplingTimer.stop();
+
+     // ----------------------------------------------------------------------------------
+     // marginal likelihood terms post-pass
+     // ----------------------------------------------------------------------------------
+
+     if(postPass)
+     {
+         PhaseTimer margLikTimer(PerfCounters::margLikPhase);
+
+         // echo debug-level message?
+         if(options.debug)
+         {
+             Rprintf("\ncpp_sampleGlm: Compute marginal likelihood estimation terms in post-pass");
+         }
+
+         // first all calls to R: the z proposals for the denominator terms
+         // and the marginal z log densities
+         const NumericVector denominatorZ = marginalZgenBlock(samples.getZ().size());
+         const NumericVector logMarginalDenominatorZ = logMarginalZdensBlock(denominatorZ);
+         const NumericVector logMarginalZ = logMarginalZdensBlock(wrap(samples.getZ()));
+         const double logMarginalHighDensityZ = marginalZ.logDens(highDensityPoint.sample.z);
+
+         // then the rest, in parallel if the g prior does not call back into R
+         MyDoubleVector numeratorTerms;
+         MyDoubleVector denominatorTerms;
+         computeMargLikTermsPostPass(*fitter.iwlsObject,
+                                     highDensityPoint,
+                                     samples,
+                                     storedLogUnPosteriors,
+                                     logMarginalZ,
+                                     denominatorZ,
+                                     logMarginalDenominatorZ,
+                                     logMarginalHighDensityZ,
+                                     rng,
+                                     config.gPrior->isThreadSafe(),
+                                     numeratorTerms,
+                                     denominatorTerms);
+
+         samples.storeMargLikTermsBlock(numeratorTerms, denominatorTerms);
+     }
+
      // ----------------------------------------------------------------------------------
      // build up return list for R and return that.
      // ----------------------------------------------------------------------------------
 
-     return List::create(_["samples"] = samples.convert2list(),
-                         _["nAccepted"] = nAccepted,
-                         _["highDensityPointLogUnPosterior"] = highDensityPoint.logUnPosterior);
+     List ret = List::create(_["samples"] = samples.convert2list(),
+                             _["nAccepted"] = nAccepted,
+                             _["highDensityPointLogUnPosterior"] = highDensityPoint.logUnPosterior);
+
+     // the performance counters and phase timers
+     ret.attr("perfCounters") = perfCounters.convert2list();
+
+     return ret;
 
 } // end cpp_sampleGlm
 
@@ -0,0 +1,542 @@
+/*
+ * streamingFit.cpp
+ *
+ *  Out-of-core fits of single GLMs and Cox models to the data in a column file.
+ */
+
+#include <streamingFit.h>
+#include <coxfit.h>
+#include <linalgInterface.h>
+#include <rcppExport.h>
+
+#include <algorithm>
+#include <memory>
+
+using namespace Rcpp;
+
+// ***************************************************************************************************//
+
+void
+StreamingChunk::read(const ColumnFile& file,
+                     const StreamingColumns& columns,
+                     bool includeIntercept,
+                     R_xlen_t first,
+                     R_xlen_t n)
+{
+    const PosInt firstCovariate = includeIntercept ? 1 : 0;
+
+    design.set_size(n, firstCovariate + columns.covariates.size());
+    if(includeIntercept)
+    {
+        design.col(0).ones();
+    }
+    for(PosInt j = 0; j != columns.covariates.size(); ++j)
+    {
+        file.read(columns.covariates[j], first, n, design.colptr(firstCovariate + j));
+    }
+
+    response.set_size(n);
+    file.read(columns.response, first, n, response.memptr());
+
+    if(columns.status >= 0)
+    {
+        status.set_size(n);
+        file.read(columns.status, first, n, status.memptr());
+
+        for(R_xlen_t i = 0; i < n; ++i)
+        {
+            if((status(i) != 0.0) && (status(i) != 1.0))
+                Rcpp::stop("the event indicators must be 0 (censored) or 1 (event)");
+        }
+    }
+
+    if(columns.weights >= 0)
+    {
+        weights.set_size(n);
+        file.read(columns.weights, first, n, weights.memptr());
+    }
+    else
+    {
+        weights.ones(n);
+    }
+
+    if(columns.offsets >= 0)
+    {
+        offsets.set_size(n);
+        file.read(columns.offsets, first, n, offsets.memptr());
+    }
+    else
+    {
+        offsets.zeros(n);
+    }
+
+    if(! design.is_finite() || ! response.is_finite() ||
+       ! weights.is_finite() || ! offsets.is_finite())
+        Rcpp::stop("the column file must not contain missing or non-finite values");
+}
+
+// ***************************************************************************************************//
+
+// solve the system A * x = rhs for the positive definite matrix A
+static AVector
+solvePositiveDefinite(const AMatrix& A,
+                      const AVector& rhs,
+                      const std::string& what)
+{
+    AMatrix factor = A;
+    AVector ret = rhs;
+
+    if((potrf(false, factor) != 0) || (potrs(false, factor, ret) != 0))
+        Rcpp::stop(what + " is not positive definite, e.g. because of collinear covariates");
+
+    return ret;
+}
+
+// ***************************************************************************************************//
+
+StreamingGlm::StreamingGlm(const ColumnFile& file,
+                           const StreamingColumns& columns,
+                           const std::string& familyString,
+                           const std::string& linkString,
+                           double phi,
+                           R_xlen_t chunkSize) :
+                           coefs(),
+                           information(),
+                           logLik(R_NaReal),
+                           file(file),
+                           columns(columns),
+                           familyString(familyString),
+                           link(newLink(linkString)),
+                           phi(phi),
+                           chunkSize(chunkSize)
+{
+}
+
+double
+StreamingGlm::accumulate(bool start,
+                         AMatrix& XtWX,
+                         AVector& XtWz) const
+{
+    const PosInt nCoefs = 1 + columns.covariates.size();
+    XtWX.zeros(nCoefs, nCoefs);
+    XtWz.zeros(nCoefs);
+
+    double ret = 0.0;
+
+    StreamingChunk chunk;
+    for(R_xlen_t first = 0; first < file.nRows(); first += chunkSize)
+    {
+        const R_xlen_t m = std::min(chunkSize, file.nRows() - first);
+        chunk.read(file, columns, true, first, m);
+
+        const std::unique_ptr<Distribution> distribution(newDistribution(familyString,
+                                                                         chunk.response,
+                                                                         chunk.weights,
+                                                                         phi));
+
+        // the linear predictor: at the start from the starting values of the means,
+        // which are chosen as by the initialize expressions of the R families
+        AVector linPred(m);
+        if(start)
+        {
+            for(R_xlen_t i = 0; i < m; ++i)
+            {
+                const double y = chunk.response(i);
+                const double mu = (familyString == "binomial") ?
+                        (chunk.weights(i) * y + 0.5) / (chunk.weights(i) + 1.0) :
+                        ((familyString == "poisson") ? y + 0.1 : y);
+                linPred(i) = link->linkfun(mu);
+            }
+        }
+        else
+        {
+            linPred = chunk.design * coefs + chunk.offsets;
+        }
+
+        // the means, the square roots of the IWLS weights and the pseudo observations
+        AVector means(m);
+        AVector sqrtWeights(m);
+        AVector pseudoObs(m);
+        for(R_xlen_t i = 0; i < m; ++i)
+        {
+            const double mu = link->linkinv(linPred(i));
+            const double dmu = link->mu_eta(linPred(i));
+
+            means(i) = mu;
+            sqrtWeights(i) = sqrt(chunk.weights(i) / phi / distribution->variance(mu)) * dmu;
+            pseudoObs(i) = linPred(i) - chunk.offsets(i) + (chunk.response(i) - mu) / dmu;
+        }
+
+        if(! start)
+        {
+            ret += distribution->loglik(means.memptr());
+        }
+
+        // add the weighted crossproducts of the chunk
+        chunk.design.each_col() %= sqrtWeights;
+        syrk(false, true, chunk.design, 1.0, XtWX);
+        XtWz += arma::trans(chunk.design) * (sqrtWeights % pseudoObs);
+
+        R_CheckUserInterrupt();
+    }
+
+    XtWX = arma::symmatl(XtWX);
+
+    if(! XtWX.is_finite() || ! XtWz.is_finite())
+        Rcpp::stop("cannot find valid starting values or weights for the IWLS");
+
+    return ret;
+}
+
+PosInt
+StreamingGlm::fit(PosInt maxIter,
+                  double epsilon)
+{
+    AMatrix XtWX;
+    AVector XtWz;
+    accumulate(true, XtWX, XtWz);
+
+    double oldDeviance = R_PosInf;
+    for(PosInt iter = 1; iter <= maxIter; ++iter)
+    {
+        // the new coefficients solve X'WX * coefs = X'Wz
+        coefs = solvePositiveDefinite(XtWX, XtWz, "the weighted crossproduct of the IWLS");
+
+        // the log-likelihood at them, and the crossproducts for the next iteration
+        logLik = accumulate(false, XtWX, XtWz);
+        information = XtWX;
+
+        // the same criterion as in glm.fit
+        const double deviance = - 2.0 * logLik;
+        if(fabs(deviance - oldDeviance) / (fabs(deviance) + 0.1) < epsilon)
+        {
+            return iter;
+        }
+        oldDeviance = deviance;
+    }
+
+    return maxIter + 1;
+}
+
+// ***************************************************************************************************//
+
+// the sums over a risk set, and over the deaths at its current tied survival time
+struct RiskSetSums
+{
+    explicit
+    RiskSetSums(PosInt nCovs) :
+        denom(0.0),
+        a(arma::zeros<AVector>(nCovs)),
+        cmat(arma::zeros<AMatrix>(nCovs, nCovs)),
+        time(R_NaN),
+        ndead(0),
+        deadwt(0.0),
+        efronwt(0.0),
+        a2(arma::zeros<AVector>(nCovs)),
+        cmat2(arma::zeros<AMatrix>(nCovs, nCovs))
+    {
+    }
+
+    // add an observation to the risk set, and its death contributions
+    // to the log-likelihood and the score vector
+    void
+    add(const AVector& x,
+        double zbeta,
+        double weight,
+        bool died,
+        double& loglik,
+        AVector& u)
+    {
+        const double risk = exp(zbeta) * weight;
+        const AMatrix xx = x * arma::trans(x);
+
+        denom += risk;
+        a += risk * x;
+        cmat += risk * xx;
+
+        if(died)
+        {
+            ++ndead;
+            deadwt += weight;
+            efronwt += risk;
+            loglik += weight * zbeta;
+            u += weight * x;
+
+            a2 += risk * x;
+            cmat2 += risk * xx;
+        }
+    }
+
+    // add the risk set terms of the tied deaths to the log-likelihood, the score vector
+    // and the information matrix, and reset the sums over the deaths
+    void
+    addDeaths(int method,
+              double& loglik,
+              AVector& u,
+              AMatrix& imat)
+    {
+        if(ndead > 0)
+        {
+            if(method == 0)
+            { // Breslow
+                const AVector mean = a / denom;
+                loglik -= deadwt * log(denom);
+                u -= deadwt * mean;
+                imat += deadwt * (cmat / denom - mean * arma::trans(mean));
+            }
+            else
+            { // Efron: the deaths are successively removed from the sums,
+              // with the average weight
+                const double wtave = deadwt / ndead;
+                for(int k = 0; k < ndead; ++k)
+                {
+                    const double temp = static_cast<double>(k) / ndead;
+                    const double d2 = denom - temp * efronwt;
+                    const AVector mean = (a - temp * a2) / d2;
+
+                    loglik -= wtave * log(d2);
+                    u -= wtave * mean;
+                    imat += wtave * ((cmat - temp * cmat2) / d2 - mean * arma::trans(mean));
+                }
+            }
+        }
+
+        ndead = 0;
+        deadwt = 0.0;
+        efronwt = 0.0;
+        a2.zeros();
+        cmat2.zeros();
+    }
+
+    // sums over the risk set
+    double denom;
+    AVector a;
+    AMatrix cmat;
+
+    // the tied survival time and the sums over the deaths at it
+    double time;
+    int ndead;
+    double deadwt;
+    double efronwt;
+    AVector a2;
+    AMatrix cmat2;
+};
+
+// ***************************************************************************************************//
+
+StreamingCox::StreamingCox(const ColumnFile& file,
+                           const StreamingColumns& columns,
+                           int method,
+                           R_xlen_t chunkSize) :
+                           coefs(arma::zeros<AVector>(columns.covariates.size())),
+                           information(),
+                           nullLogLik(R_NaReal),
+                           logLik(R_NaReal),
+                           file(file),
+                           columns(columns),
+                           method(method),
+                           chunkSize(chunkSize),
+                           means(arma::zeros<AVector>(columns.covariates.size()))
+{
+    if(file.nRows() == 0)
+        Rcpp::stop("the column file has no rows");
+
+    // check the order of the survival times, and compute the covariate means
+    double lastTime = R_NegInf;
+
+    StreamingChunk chunk;
+    for(R_xlen_t first = 0; first < file.nRows(); first += chunkSize)
+    {
+        const R_xlen_t m = std::min(chunkSize, file.nRows() - first);
+        chunk.read(file, columns, false, first, m);
+
+        for(R_xlen_t i = 0; i < m; ++i)
+        {
+            if(chunk.response(i) < lastTime)
+                Rcpp::stop("the rows of the column file must be sorted by increasing survival times");
+            lastTime = chunk.response(i);
+        }
+
+        means += arma::trans(arma::sum(chunk.design, 0));
+    }
+
+    means /= static_cast<double>(file.nRows());
+}
+
+double
+StreamingCox::accumulate(const AVector& beta,
+                         AVector& u,
+                         AMatrix& imat) const
+{
+    const PosInt nCovs = beta.n_elem;
+    u.zeros(nCovs);
+    imat.zeros(nCovs, nCovs);
+
+    double loglik = 0.0;
+    RiskSetSums sums(nCovs);
+
+    // start at the largest time, accumulating the risk set 1 by 1:
+    // so the chunks are processed from the last to the first
+    StreamingChunk chunk;
+    const R_xlen_t nChunks = (file.nRows() + chunkSize - 1) / chunkSize;
+    for(R_xlen_t c = nChunks - 1; c >= 0; --c)
+    {
+        const R_xlen_t first = c * chunkSize;
+        const R_xlen_t m = std::min(chunkSize, file.nRows() - first);
+        chunk.read(file, columns, false, first, m);
+
+        chunk.design.each_row() -= arma::trans(means);
+        const AVector linPred = chunk.design * beta + chunk.offsets;
+
+        for(R_xlen_t person = m - 1; person >= 0; --person)
+        {
+            // the deaths at the previous time are complete, when all tied observations
+            // (also those in other chunks) are in the risk set
+            if(chunk.response(person) != sums.time)
+            {
+                sums.addDeaths(method, loglik, u, imat);
+                sums.time = chunk.response(person);
+            }
+
+            sums.add(arma::trans(chunk.design.row(person)),
+                     coxsafe(linPred(person)),
+                     chunk.weights(person),
+                     chunk.status(person) == 1.0,
+                     loglik,
+                     u);
+        }
+
+        R_CheckUserInterrupt();
+    }
+    sums.addDeaths(method, loglik, u, imat);
+
+    return loglik;
+}
+
+PosInt
+StreamingCox::fit(PosInt maxIter,
+                  double epsilon)
+{
+    AVector u;
+    AMatrix imat;
+
+    // the initial iteration step at beta = 0
+    coefs.zeros();
+    nullLogLik = logLik = accumulate(coefs, u, imat);
+    information = imat;
+
+    if(coefs.is_empty())
+    {
+        return 0;
+    }
+
+    // then the Newton-Raphson iterations with step halving, as in Coxfit::fit
+    AVector newBeta = coefs + solvePositiveDefinite(imat, u, "the information matrix of the Cox model");
+    bool halving = false;
+
+    for(PosInt iter = 1; iter <= maxIter; ++iter)
+    {
+        const double newLogLik = accumulate(newBeta, u, imat);
+
+        if((fabs(1.0 - logLik / newLogLik) <= epsilon) && ! halving)
+        {
+            coefs = newBeta;
+            logLik = newLogLik;
+            information = imat;
+            return iter;
+        }
+
+        if(iter == maxIter)
+        {
+            coefs = newBeta;
+            logLik = newLogLik;
+            information = imat;
+            break;
+        }
+
+        if(newLogLik < logLik)
+        { // it is not converging: half of the old increment
+            halving = true;
+            newBeta = (newBeta + coefs) / 2.0;
+        }
+        else
+        {
+            halving = false;
+            logLik = newLogLik;
+            coefs = newBeta;
+            newBeta = coefs + solvePositiveDefinite(imat, u, "the information matrix of the Cox model");
+        }
+    }
+
+    return maxIter + 1;
+}
+
+// ***************************************************************************************************//
+
+// convert the R list of 1-based column indices (0 for unused weights or offsets)
+static StreamingColumns
+getStreamingColumns(List rcpp_columns)
+{
+    StreamingColumns ret;
+
+    const IntVector covariates = as<IntVector>(rcpp_columns["covariates"]);
+    for(IntVector::const_iterator j = covariates.begin(); j != covariates.end(); ++j)
+    {
+        ret.covariates.push_back(*j - 1);
+    }
+
+    ret.response = as<int>(rcpp_columns["response"]) - 1;
+    ret.status = rcpp_columns.containsElementNamed("status") ?
+            as<int>(rcpp_columns["status"]) - 1 : -1;
+    ret.weights = as<int>(rcpp_columns["weights"]) - 1;
+    ret.offsets = as<int>(rcpp_columns["offsets"]) - 1;
+
+    return ret;
+}
+
+// fit a GLM to the data in a column file
+// [[Rcpp::export]]
+SEXP
+cpp_streamGlm(SEXP R_file, SEXP R_columns, SEXP R_family, SEXP R_options)
+{
+    const ColumnFile file(as<std::string>(R_file));
+    List rcpp_family(R_family);
+    List rcpp_options(R_options);
+
+    StreamingGlm glm(file,
+                     getStreamingColumns(List(R_columns)),
+                     as<std::string>(rcpp_family["family"]),
+                     as<std::string>(rcpp_family["link"]),
+                     as<double>(rcpp_family["phi"]),
+                     static_cast<R_xlen_t>(as<double>(rcpp_options["chunkSize"])));
+
+    const PosInt nIter = glm.fit(as<PosInt>(rcpp_options["maxit"]),
+                                 as<double>(rcpp_options["epsilon"]));
+
+    return List::create(_["coefs"] = glm.coefs,
+                        _["information"] = glm.information,
+                        _["logLik"] = glm.logLik,
+                        _["nIter"] = nIter);
+}
+
+// fit a Cox model to the data in a column file
+// [[Rcpp::export]]
+SEXP
+cpp_streamCox(SEXP R_file, SEXP R_columns, SEXP R_options)
+{
+    const ColumnFile file(as<std::string>(R_file));
+    List rcpp_options(R_options);
+
+    StreamingCox cox(file,
+                     getStreamingColumns(List(R_columns)),
+                     as<int>(rcpp_options["method"]),
+                     static_cast<R_xlen_t>(as<double>(rcpp_options["chunkSize"])));
+
+    const PosInt nIter = cox.fit(as<PosInt>(rcpp_options["maxit"]),
+                                 as<double>(rcpp_options["epsilon"]));
+
+    return List::create(_["coefs"] = cox.coefs,
+                        _["information"] = cox.information,
+                        _["loglik"] = NumericVector::create(cox.nullLogLik, cox.logLik),
+                        _["nIter"] = nIter);
+}
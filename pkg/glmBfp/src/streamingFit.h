@@ -0,0 +1,158 @@
+/*
+ * streamingFit.h
+ *
+ *  Out-of-core fits of single GLMs and Cox models to the data in a column file: all sums
+ *  over the observations, i.e. the weighted crossproducts of the IWLS and the risk set sums
+ *  of the Cox model, are accumulated in streaming chunks of rows, so that the data never
+ *  need to be held in memory. The residual deviances are the statistics of the TBF approach.
+ */
+
+#ifndef STREAMINGFIT_H_
+#define STREAMINGFIT_H_
+
+#include <types.h>
+#include <columnFile.h>
+#include <links.h>
+#include <distributions.h>
+
+#include <string>
+
+// ***************************************************************************************************//
+
+// the columns of a column file which are used by the streaming fits, all 0-based
+struct StreamingColumns
+{
+    // the covariates (the GLM has an additional intercept)
+    PosIntVector covariates;
+
+    // the response of the GLM, or the survival times of the Cox model
+    PosInt response;
+
+    // the event indicator of the Cox model (1 = event, 0 = censored), -1 for the GLM
+    Int status;
+
+    // optional weights and offsets (-1 if not used)
+    Int weights;
+    Int offsets;
+};
+
+// ***************************************************************************************************//
+
+// one chunk of rows: the design matrix (including the intercept column if requested),
+// the response, the event indicators (only for the Cox model), and the weights and offsets
+// (ones and zeroes if not used)
+struct StreamingChunk
+{
+    AMatrix design;
+    AVector response;
+    AVector status;
+    AVector weights;
+    AVector offsets;
+
+    // read the rows first, ..., first + n - 1
+    void
+    read(const ColumnFile& file,
+         const StreamingColumns& columns,
+         bool includeIntercept,
+         R_xlen_t first,
+         R_xlen_t n);
+};
+
+// ***************************************************************************************************//
+
+// The IWLS fit of a GLM. Each iteration is one pass over the chunks, which accumulates
+// X'WX and X'Wz at the current coefficients, together with their log-likelihood.
+class StreamingGlm
+{
+public:
+    StreamingGlm(const ColumnFile& file,
+                 const StreamingColumns& columns,
+                 const std::string& familyString,
+                 const std::string& linkString,
+                 double phi,
+                 R_xlen_t chunkSize);
+
+    ~StreamingGlm()
+    {
+        delete link;
+    }
+
+    // fit until the relative change of the deviance is below epsilon,
+    // and return the number of iterations (maxIter + 1 if not converged)
+    PosInt
+    fit(PosInt maxIter,
+        double epsilon);
+
+    // the results: the coefficients (the intercept first), the Fisher information X'WX at them,
+    // and the log-likelihood, so that the deviance is - 2 * logLik
+    AVector coefs;
+    AMatrix information;
+    double logLik;
+
+private:
+    // not copyable
+    StreamingGlm(const StreamingGlm&);
+    StreamingGlm& operator=(const StreamingGlm&);
+
+    // one pass over the chunks: accumulate X'WX and X'Wz at the current coefficients,
+    // or at the starting values of the means if start is true, and return the log-likelihood
+    // at the current coefficients
+    double
+    accumulate(bool start,
+               AMatrix& XtWX,
+               AVector& XtWz) const;
+
+    const ColumnFile& file;
+    const StreamingColumns columns;
+    const std::string familyString;
+    const Link* link;
+    const double phi;
+    const R_xlen_t chunkSize;
+};
+
+// ***************************************************************************************************//
+
+// The Newton-Raphson fit of a Cox model with the Breslow or Efron method for ties.
+// The rows of the column file must be sorted by increasing survival times. Each iteration is
+// one pass over the chunks from the last to the first row, which accumulates the risk set sums
+// and from them the partial log-likelihood, the score vector and the information matrix,
+// as in Coxfit::fit.
+class StreamingCox
+{
+public:
+    StreamingCox(const ColumnFile& file,
+                 const StreamingColumns& columns,
+                 int method, // 0 = Breslow, 1 = Efron
+                 R_xlen_t chunkSize);
+
+    // fit until the relative change of the partial log-likelihood is below epsilon,
+    // and return the number of iterations (maxIter + 1 if not converged)
+    PosInt
+    fit(PosInt maxIter,
+        double epsilon);
+
+    // the results: the coefficients, the information matrix at them, and the
+    // partial log-likelihoods of the null model (all coefficients zero) and of the fit.
+    AVector coefs;
+    AMatrix information;
+    double nullLogLik;
+    double logLik;
+
+private:
+    // one pass over the chunks: accumulate the score vector u and the information matrix
+    // imat at beta, and return the partial log-likelihood
+    double
+    accumulate(const AVector& beta,
+               AVector& u,
+               AMatrix& imat) const;
+
+    const ColumnFile& file;
+    const StreamingColumns columns;
+    const int method;
+    const R_xlen_t chunkSize;
+
+    // the covariate means, which are subtracted for numerical stability
+    AVector means;
+};
+
+#endif /* STREAMINGFIT_H_ */
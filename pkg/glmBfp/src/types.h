@@ -59,6 +59,8 @@ static const double EPS = sqrt(DOUBLE_EPS);
 typedef arma::colvec AVector;
 // a matrix
 typedef arma::mat AMatrix;
+// a matrix in single precision, only used for storage
+typedef arma::fmat SMatrix;
 
 
 // Special types ***************************************
@@ -4,6 +4,7 @@
 #include <rcppExport.h>
 #include <linalgInterface.h>
 #include <coxfit.h>
+#include <perfCounters.h>
 
 // 03/07/2013: use offsets
 
@@ -17,6 +18,7 @@ NegLogUnnormZDens::NegLogUnnormZDens(const ModelPar &mod,
                                      // return the approximate *conditional* density f(y | z, mod) by operator()?
                                      // otherwise return the approximate unnormalized *joint* density f(y, z | mod).
                                      const Book& bookkeep,
+                                     const AVector* linPredWarmStart,
                                      PosInt nIter) :
                                      mod(mod),
                                      fpInfo(fpInfo),
@@ -27,12 +29,15 @@ NegLogUnnormZDens::NegLogUnnormZDens(const ModelPar &mod,
                                      coxfitObject(0),
                                      nIter(nIter),
                                      modSize(mod.size(ucInfo, fixInfo)), 
-                                     modResidualDeviance(R_NaReal)
+                                     modResidualDeviance(R_NaReal),
+                                     warnOnFailure(true),
+                                     modeValue(R_PosInf),
+                                     modeLinPred()
 {
     if(bookkeep.doGlm)
     {
         iwlsObject = new Iwls(mod, data, fpInfo, ucInfo, fixInfo, config,
-                              config.linPredStart,
+                              (linPredWarmStart && ! linPredWarmStart->is_empty()) ? *linPredWarmStart : config.linPredStart,
                               // take the same original start value for each model, but then update
                               // it inside the iwls object when new calls to the functor are made.
                               (bookkeep.useFixedg || bookkeep.empiricalBayes),
@@ -55,6 +60,9 @@ NegLogUnnormZDens::NegLogUnnormZDens(const ModelPar &mod,
     }
     else
     {
+        PhaseTimer timer(PerfCounters::coxfitPhase);
+        perfCounters.increment(PerfCounters::coxFits);
+
         coxfitObject = new Coxfit(data.response,
                                   data.censInd,
                                   getDesignMatrix(mod, data, fpInfo, ucInfo, fixInfo, false),
@@ -128,6 +136,8 @@ NegLogUnnormZDens::getTBFMaxLogCondMargLik(double& zMode) const
 double
 NegLogUnnormZDens::operator()(double z)
 {
+    perfCounters.increment(PerfCounters::zDensityCalls);
+
     // map back to the original covariance factor scale
     const double g = exp(z);
 
@@ -236,9 +246,6 @@ NegLogUnnormZDens::operator()(double z)
                 // for the sum over m_i^(3) * x_i * B_i:
                 AVector k = arma::zeros(iwlsObject->nCoefs);
 
-                // design matrix is also needed
-                const AMatrix& design = iwlsObject->design;
-
                 // iterate through the observations:
                 for(PosInt i = 0; i < iwlsObject->nObs; ++i)
                 {
@@ -267,14 +274,15 @@ NegLogUnnormZDens::operator()(double z)
                     }
 
                     // add to the sums:
-                    AVector tmp = arma::trans(design.row(i));
+                    const AVector designRow = iwlsObject->designRow(i);
+                    AVector tmp = designRow;
                     trs(false, false, iwlsResults.qFactor, tmp);
                     const double B = arma::dot(tmp, tmp);
                     const double B2 = B * B;
 
                     exp_T4 += m4 * B2;
                     exp_T6 += m6 * B2 * B;
-                    k += (m3 * B) * arma::trans(design.row(i));
+                    k += (m3 * B) * designRow;
                 }
 
                 // calculate k^T * Cov * k, and overwrite k with the intermediate result:
@@ -308,6 +316,13 @@ NegLogUnnormZDens::operator()(double z)
                 stream << "NegLogUnnormZDens() got non-finite result " << ret << " for z=" << z;
                 throw std::domain_error(stream.str().c_str());
             }
+
+            // remember the linear predictor near the mode
+            if(ret < modeValue)
+            {
+                modeValue = ret;
+                modeLinPred = iwlsResults.linPred;
+            }
         }
         // catch errors in IWLS and non-finite result
         catch (std::domain_error& error)
@@ -317,8 +332,11 @@ NegLogUnnormZDens::operator()(double z)
                 Rprintf("For z=%f, the density value could not be computed because\n%s",
                         z, error.what());
             }
-            Rf_warning("for z=%f, the density value could not be computed for the following model:\n%s\nCheck for near-collinearity of covariates.",
-                       z, mod.print(fpInfo).c_str());
+            if(warnOnFailure)
+            {
+                Rf_warning("for z=%f, the density value could not be computed for the following model:\n%s\nCheck for near-collinearity of covariates.",
+                           z, mod.print(fpInfo).c_str());
+            }
 
             // return NaN. This can be handled by the Brent optimize routine! It apparently replaces it (implicitely) by
             // the highest positive number.
@@ -32,6 +32,9 @@ public:
                       // return the approximate *conditional* density f(y | z, mod) by operator()?
                       // otherwise return the approximate unnormalized *joint* density f(y, z | mod).
                       const Book& bookkeep,
+                      // optional start linear predictor for the IWLS, e.g. from a similar model
+                      // (otherwise the start linear predictor from config is used)
+                      const AVector* linPredWarmStart=0,
                       PosInt nIter=40);
 
     // try to get the TBF log marginal likelihood
@@ -50,6 +53,23 @@ public:
         return modResidualDeviance;
     }
 
+    // get the linear predictor of the IWLS at the smallest function value computed so far,
+    // which is empty if there was none (e.g. for Cox models or with TBF)
+    const AVector&
+    getModeLinPred() const
+    {
+        return modeLinPred;
+    }
+
+    // should operator() warn if the density value cannot be computed for some z?
+    // (this must be switched off if the function object is used outside the main thread,
+    // then the caller has to warn about the NaN results)
+    void
+    setWarnOnFailure(bool warn)
+    {
+        warnOnFailure = warn;
+    }
+
     // destructor
     ~NegLogUnnormZDens()
     {
@@ -82,6 +102,13 @@ private:
 
     // the residual deviance of the model (only filled with correct value if TBF approach is used)
     double modResidualDeviance;
+
+    // warn from operator() on failures?
+    bool warnOnFailure;
+
+    // the smallest function value computed so far, and the corresponding IWLS linear predictor
+    double modeValue;
+    AVector modeLinPred;
 };
 
 